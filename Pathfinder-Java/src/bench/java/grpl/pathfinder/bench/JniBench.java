@@ -0,0 +1,222 @@
+package grpl.pathfinder.bench;
+
+import grpl.pathfinder.Vec2;
+import grpl.pathfinder.coupled.CoupledCausalTrajGen;
+import grpl.pathfinder.coupled.CoupledChassis;
+import grpl.pathfinder.coupled.CoupledState;
+import grpl.pathfinder.coupled.CoupledStateBuffer;
+import grpl.pathfinder.coupled.CoupledWheelState;
+import grpl.pathfinder.coupled.Trajectory;
+import grpl.pathfinder.path.ArcParameterizer;
+import grpl.pathfinder.path.CurveBuffer;
+import grpl.pathfinder.path.HermiteFactory;
+import grpl.pathfinder.path.HermiteQuintic;
+import grpl.pathfinder.profile.TrapezoidalProfile;
+import grpl.pathfinder.transmission.DcMotor;
+
+import java.io.File;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.lang.management.ManagementFactory;
+import java.lang.management.ThreadMXBean;
+import java.net.InetAddress;
+import java.time.ZonedDateTime;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Benchmarks of the JNI crossings of the Java API, the Java counterpart to the native benchmarks of
+ * Pathfinder/src/bench.
+ * <p>
+ * Each benchmark measures a whole Java API call: the crossing into the native library, the native work, and
+ * any allocation of arrays and objects for the result. Results are written as Google Benchmark JSON, so may
+ * be compared against a baseline with Pathfinder/src/bench/compare.py.
+ * </p>
+ * <p>
+ * Usage: JniBench [output.json]. The minimum time of each benchmark, in seconds, may be set with the
+ * pathfinder.bench.minTime system property.
+ * </p>
+ */
+public class JniBench {
+
+    private interface Op {
+        void run();
+    }
+
+    private static class Result {
+        String name;
+        long iterations;
+        double realNs, cpuNs;
+    }
+
+    private static final ThreadMXBean THREADS = ManagementFactory.getThreadMXBean();
+
+    // Results are accumulated here so the JIT cannot eliminate the calls.
+    private static volatile double sink;
+
+    private final double minTime = Double.parseDouble(System.getProperty("pathfinder.bench.minTime", "0.5"));
+    private final List<Result> results = new ArrayList<>();
+
+    private void bench(String name, Op op) {
+        // Warm up, such that the JIT has compiled the call before it is measured.
+        run(op, 1000);
+
+        long iterations = 1;
+        while (true) {
+            long start = System.nanoTime();
+            long cpuStart = THREADS.getCurrentThreadCpuTime();
+            run(op, iterations);
+            long cpu = THREADS.getCurrentThreadCpuTime() - cpuStart;
+            long real = System.nanoTime() - start;
+
+            if (real >= minTime * 1e9 || iterations >= (1L << 30)) {
+                Result r = new Result();
+                r.name = "BM_JNI_" + name;
+                r.iterations = iterations;
+                r.realNs = (double) real / iterations;
+                r.cpuNs = (double) cpu / iterations;
+                results.add(r);
+                System.out.printf("%-40s %12.1f ns %12.1f ns %12d%n", r.name, r.realNs, r.cpuNs, iterations);
+                return;
+            }
+            // Scale up towards the minimum time, as Google Benchmark does.
+            double scale = real > 0 ? 1.4 * minTime * 1e9 / real : 10;
+            iterations = Math.max(iterations + 1, (long) (iterations * Math.min(10, scale)));
+        }
+    }
+
+    private static void run(Op op, long iterations) {
+        for (long i = 0; i < iterations; i++)
+            op.run();
+    }
+
+    private void write(File file) throws IOException {
+        File parent = file.getAbsoluteFile().getParentFile();
+        if (parent != null)
+            parent.mkdirs();
+
+        try (PrintWriter out = new PrintWriter(file, "UTF-8")) {
+            out.println("{");
+            out.println("  \"context\": {");
+            out.printf("    \"date\": \"%s\",%n", ZonedDateTime.now());
+            out.printf("    \"host_name\": \"%s\",%n", InetAddress.getLocalHost().getHostName());
+            out.println("    \"executable\": \"JniBench\",");
+            out.printf("    \"num_cpus\": %d,%n", Runtime.getRuntime().availableProcessors());
+            out.printf("    \"java_version\": \"%s\"%n", System.getProperty("java.version"));
+            out.println("  },");
+            out.println("  \"benchmarks\": [");
+            for (int i = 0; i < results.size(); i++) {
+                Result r = results.get(i);
+                out.println("    {");
+                out.printf("      \"name\": \"%s\",%n", r.name);
+                out.printf("      \"run_name\": \"%s\",%n", r.name);
+                out.println("      \"run_type\": \"iteration\",");
+                out.printf("      \"iterations\": %d,%n", r.iterations);
+                out.printf("      \"real_time\": %.4f,%n", r.realNs);
+                out.printf("      \"cpu_time\": %.4f,%n", r.cpuNs);
+                out.println("      \"time_unit\": \"ns\"");
+                out.println(i == results.size() - 1 ? "    }" : "    },");
+            }
+            out.println("  ]");
+            out.println("}");
+        }
+    }
+
+    public static void main(String[] args) throws IOException {
+        JniBench bench = new JniBench();
+
+        DcMotor motor = new DcMotor(12.0, 5330 * 2.0 * Math.PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0, 2 * 2.41 * 12.75);
+        CoupledChassis chassis = new CoupledChassis(motor, motor, 0.0762, 0.5, 25.0);
+
+        List<HermiteQuintic.Waypoint> waypoints = new ArrayList<>();
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(0, 0), Vec2.cartesian(5, 0), Vec2.cartesian(0, 0)));
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(4, 4), Vec2.cartesian(0, 5), Vec2.cartesian(0, 0)));
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(8, 0), Vec2.cartesian(5, 0), Vec2.cartesian(0, 0)));
+        double[] flat = HermiteQuintic.Waypoint.flatten(waypoints);
+
+        ArcParameterizer param = new ArcParameterizer();
+        param.configure(0.1, 0.1);
+        TrapezoidalProfile profile = new TrapezoidalProfile();
+
+        List<HermiteQuintic> hermites = HermiteFactory.generateQuintic(waypoints);
+        CurveBuffer curves = param.parameterizeWaypoints(flat);
+        CoupledCausalTrajGen gen = new CoupledCausalTrajGen(chassis);
+        gen.configure(curves, profile);
+
+        // Single calls, each crossing JNI once.
+        HermiteQuintic hermite = hermites.get(0);
+        double[] t = {0};
+        bench.bench("SplinePosition", () -> {
+            t[0] = t[0] >= 1 ? 0 : t[0] + 0.001;
+            sink += hermite.position(t[0]).x();
+        });
+
+        CoupledState centre = new CoupledState();
+        centre.kinematics.velocity = 2;
+        centre.curvature = 0.5;
+        bench.bench("ChassisSplit", () -> {
+            CoupledWheelState[] split = chassis.split(centre);
+            sink += split[0].voltage;
+        });
+
+        CoupledState[] last = {new CoupledState()};
+        bench.bench("GenerateObject", () -> {
+            CoupledState next = gen.generate(last[0], last[0].time + 0.005);
+            last[0] = next.finished ? new CoupledState() : next;
+        });
+
+        CoupledStateBuffer buffer = new CoupledStateBuffer();
+        bench.bench("GenerateDirect", () -> {
+            gen.generate(buffer, buffer, buffer.get(CoupledStateBuffer.TIME) + 0.005);
+            if (buffer.get(CoupledStateBuffer.FINISHED) != 0)
+                buffer.set(new CoupledState());
+        });
+
+        double[] states = new double[1000 * CoupledStateBuffer.SIZE];
+        CoupledState initial = new CoupledState();
+        bench.bench("GenerateBatch1000", () -> sink += gen.generateBatch(initial, 0.005, 1000, states, null));
+
+        // Building a whole path: one crossing per spline and per segment, against a single crossing.
+        bench.bench("BuildPathPerSegment", () -> {
+            List<HermiteQuintic> splines = HermiteFactory.generateQuintic(waypoints);
+            try (CurveBuffer c = param.parameterizeToBuffer(splines)) {
+                sink += c.size();
+            }
+            for (HermiteQuintic spline : splines)
+                spline.close();
+        });
+
+        bench.bench("BuildPathWaypoints", () -> {
+            try (CurveBuffer c = param.parameterizeWaypoints(flat)) {
+                sink += c.size();
+            }
+        });
+
+        double[] distances = new double[100];
+        double[] samples = new double[CurveBuffer.SAMPLE_SIZE * distances.length];
+        double length = curves.length();
+        for (int i = 0; i < distances.length; i++)
+            distances[i] = length * i / (distances.length - 1);
+        bench.bench("CurveBufferSample100", () -> {
+            curves.sample(distances, samples);
+            sink += samples[0];
+        });
+
+        bench.bench("TrajectoryGenerate", () -> {
+            try (Trajectory traj = Trajectory.generate(chassis, flat, param, profile, 0.005, 15.0)) {
+                sink += traj.size();
+            }
+        });
+
+        bench.write(new File(args.length > 0 ? args[0] : "jnibench.json"));
+
+        for (HermiteQuintic spline : hermites)
+            spline.close();
+        gen.close();
+        curves.close();
+        profile.close();
+        param.close();
+        chassis.close();
+        motor.close();
+    }
+}
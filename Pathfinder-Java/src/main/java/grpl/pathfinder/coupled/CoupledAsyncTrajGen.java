@@ -0,0 +1,123 @@
+package grpl.pathfinder.coupled;
+
+import grpl.pathfinder.path.ArcParameterizer;
+import grpl.pathfinder.path.HermiteQuintic;
+import grpl.pathfinder.profile.Profile;
+import grpl.pathfinder.util.NativeResource;
+
+import java.util.List;
+
+/**
+ * Asynchronous trajectory generator, generating full trajectories on native worker threads.
+ * <p>
+ * Generating a long path (fitting splines, parameterizing them into arcs and generating every state of the
+ * trajectory) can take tens of milliseconds, which is too long to block a periodic control loop. This
+ * generator runs the whole pipeline in the background on a pool of native threads, returning a
+ * {@link TrajectoryFuture} immediately. The control loop polls {@link TrajectoryFuture#isDone()} and picks
+ * up the finished {@link Trajectory}, which is held in native memory and read without copying.
+ * </p>
+ * <p>
+ * Requests are run in order of submission, except that {@link Priority#URGENT} requests (such as a
+ * trajectory needed by the current control loop cycle) are run before any normal requests still waiting.
+ * Requests may be cancelled, whether waiting or running.
+ * </p>
+ * <p>
+ * The chassis and profile are shared with the worker threads, so must not be closed (or, for the profile,
+ * reconfigured) while a request using them is running. The parameterizer, and the goal and limits of the
+ * profile, are copied on submission.
+ * </p>
+ */
+public class CoupledAsyncTrajGen extends NativeResource {
+
+    /**
+     * The maximum duration of a generated trajectory, in seconds. Trajectories that take longer are
+     * returned unfinished (see {@link Trajectory#finished()}).
+     */
+    public static final double DEFAULT_TIMEOUT = 15.0;
+
+    /**
+     * The priority of a request.
+     */
+    public enum Priority {
+        /**
+         * Run in order of submission, after any urgent requests.
+         */
+        NORMAL,
+        /**
+         * Run before all normal requests that are still waiting, such as for a trajectory needed this tick.
+         */
+        URGENT
+    }
+
+    private CoupledChassis chassis;
+
+    /**
+     * Create a new asynchronous trajectory generator, starting its worker threads.
+     *
+     * @param chassis The coupled chassis, used to provide limits for the trajectory kinematics.
+     * @param workers The number of native worker threads. If 0, one thread per processor is used.
+     */
+    public CoupledAsyncTrajGen(CoupledChassis chassis, int workers) {
+        super(allocate(workers));
+        this.chassis = chassis;
+    }
+
+    /**
+     * Create a new asynchronous trajectory generator, with a single worker thread.
+     *
+     * @param chassis The coupled chassis, used to provide limits for the trajectory kinematics.
+     */
+    public CoupledAsyncTrajGen(CoupledChassis chassis) {
+        this(chassis, 1);
+    }
+
+    /**
+     * Submit a path to generate in the background.
+     *
+     * @param waypoints The waypoints of the path, fit with quintic hermite splines.
+     * @param param     The arc parameterizer to parameterize the splines with. Copied on submission.
+     * @param profile   The profile to use for the trajectory. Must be a native profile, such as
+     *                  {@link grpl.pathfinder.profile.TrapezoidalProfile}.
+     * @param dt        The timestep between states of the trajectory, in seconds.
+     * @param priority  The priority of the request.
+     * @return A future for the trajectory. The caller is responsible for closing it.
+     */
+    public TrajectoryFuture submit(List<? extends HermiteQuintic.Waypoint> waypoints, ArcParameterizer param,
+                                   Profile profile, double dt, Priority priority) {
+        if (!(profile instanceof NativeResource))
+            throw new UnsupportedOperationException("Non-native profiles are not yet supported. See issue #11");
+
+        long future = submit(nativeHandle(), chassis.nativeHandle(), param.nativeHandle(),
+                ((NativeResource) profile).nativeHandle(), HermiteQuintic.Waypoint.flatten(waypoints), dt,
+                DEFAULT_TIMEOUT, priority == Priority.URGENT);
+        return new TrajectoryFuture(future, chassis, profile);
+    }
+
+    /**
+     * Submit a path to generate in the background, with normal priority.
+     * <p>
+     * See {@link #submit(List, ArcParameterizer, Profile, double, Priority)}.
+     * </p>
+     */
+    public TrajectoryFuture submit(List<? extends HermiteQuintic.Waypoint> waypoints, ArcParameterizer param,
+                                   Profile profile, double dt) {
+        return submit(waypoints, param, profile, dt, Priority.NORMAL);
+    }
+
+    /**
+     * Stop the worker threads. Waiting requests are cancelled, and running requests are asked to stop and
+     * waited on.
+     */
+    @Override
+    public void close() {
+        free(nativeHandle());
+        zeroHandle();
+    }
+
+    /* JNI */
+    private static native long allocate(int workers);
+
+    private static native void free(long h);
+
+    private static native long submit(long h, long chassisHandle, long paramHandle, long profileHandle, double[] waypoints, double dt, double timeout, boolean urgent);
+}
@@ -1,10 +1,13 @@
 package grpl.pathfinder.coupled;
 
 import grpl.pathfinder.path.Curve2d;
+import grpl.pathfinder.path.CurveBuffer;
 import grpl.pathfinder.profile.Profile;
 import grpl.pathfinder.util.INativeResource;
 import grpl.pathfinder.util.NativeResource;
 
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
 import java.util.List;
 
 /**
@@ -31,6 +34,8 @@ public class CoupledCausalTrajGen extends NativeResource {
 
     private CoupledChassis chassis;
     private long nativeCurveBuffer = 0L;
+    // The native curve buffer refers to the curves of this buffer, if configured with one.
+    private CurveBuffer curveBuffer;
 
     private Profile profile;
     private NativeResource nativeProfile;
@@ -60,21 +65,28 @@ public class CoupledCausalTrajGen extends NativeResource {
      *                is recommended.
      */
     public void configure(List<? extends Curve2d> curves, Profile profile) {
-        this.profile = profile;
-
-        if (profile instanceof NativeResource) {
-            this.nativeProfile = (NativeResource) profile;
-        } else {
-            throw new UnsupportedOperationException("Non-native profiles are not yet supported. See issue #11");
-        }
-
-        if (this.nativeCurveBuffer != 0L)
-            releaseBuffer(this.nativeCurveBuffer);
-        this.nativeCurveBuffer = acquireBuffer();
-
+        configureProfile(profile);
+        this.curveBuffer = null;
         pack(this.nativeCurveBuffer, curves);
     }
 
+    /**
+     * Configure the curves and profile to use for the Causal Trajectory Generator, using the curves of a
+     * native {@link CurveBuffer} without copying or wrapping each curve.
+     * <p>
+     * The curve buffer must remain open while this generator is in use.
+     * </p>
+     *
+     * @param curves  The buffer of curves to use for the trajectory (the path)
+     * @param profile The profile to use for the trajectory. {@link grpl.pathfinder.profile.TrapezoidalProfile}
+     *                is recommended.
+     */
+    public void configure(CurveBuffer curves, Profile profile) {
+        configureProfile(profile);
+        this.curveBuffer = curves;
+        enqueueCurveBuffer(this.nativeCurveBuffer, curves.nativeHandle());
+    }
+
     /**
      * Generate the next state of the trajectory given the current state.
      * <p>
@@ -89,6 +101,79 @@ public class CoupledCausalTrajGen extends NativeResource {
         return new CoupledState(generateNative(nativeHandle(), chassis.nativeHandle(), nativeCurveBuffer, nativeProfile.nativeHandle(), lastState.toArray(), time));
     }
 
+    /**
+     * Generate the next state of the trajectory given the current state, without allocating.
+     * <p>
+     * The states are exchanged with the native library through persistent direct buffers, so this
+     * method allocates nothing on either the Java or native side. This is preferred over
+     * {@link #generate(CoupledState, double)} in control loops.
+     * </p>
+     * <p>
+     * Requires a call to {@link #configure(List, Profile)} to setup the system.
+     * </p>
+     *
+     * @param lastState The current ("last") state of the trajectory. If this is the first call to
+     *                  generate, this may be considered the "initial conditions".
+     * @param output    The buffer to write the next state to. This may be the same buffer as lastState.
+     * @param time      The time of the next point (lastState.time() + dt), in seconds.
+     */
+    public void generate(CoupledStateBuffer lastState, CoupledStateBuffer output, double time) {
+        generateDirect(nativeHandle(), chassis.nativeHandle(), nativeCurveBuffer, nativeProfile.nativeHandle(), lastState.buffer(), output.buffer(), time);
+    }
+
+    /**
+     * Generate many states of the trajectory at a fixed timestep, in a single native call.
+     * <p>
+     * Generation stops after maxSteps states, when the trajectory is finished, or when either output array
+     * is full, whichever comes first. States are written to the output arrays in the layout of
+     * {@link CoupledState#toArray()} and {@link CoupledWheelState#toArray()}. The state at step i (from 0)
+     * is at time initial.time + (i + 1) * dt.
+     * </p>
+     * <p>
+     * The output arrays are held by the native library for the duration of the call, which may delay
+     * garbage collection, so very large batches are better split into several calls.
+     * </p>
+     * <p>
+     * Requires a call to {@link #configure(List, Profile)} to setup the system.
+     * </p>
+     *
+     * @param initial  The initial state of the trajectory.
+     * @param dt       The timestep between consecutive states, in seconds.
+     * @param maxSteps The maximum number of states to generate.
+     * @param states   The output array for the centre states, of {@link CoupledStateBuffer#SIZE} doubles
+     *                 per state.
+     * @param wheels   The output array for the wheel states, of 2 * {@link CoupledWheelState#SIZE} doubles
+     *                 per state (left, then right), or null to not split the states.
+     * @return The number of states generated. The last state is finished if the trajectory was completed.
+     */
+    public int generateBatch(CoupledState initial, double dt, int maxSteps, double[] states, double[] wheels) {
+        return generateBatchNative(nativeHandle(), chassis.nativeHandle(), nativeCurveBuffer, nativeProfile.nativeHandle(), initial.toArray(), dt, maxSteps, states, wheels);
+    }
+
+    /**
+     * Generate the trajectory at a fixed timestep, in a single native call.
+     * <p>
+     * See {@link #generateBatch(CoupledState, double, int, double[], double[])}.
+     * </p>
+     *
+     * @param initial  The initial state of the trajectory.
+     * @param dt       The timestep between consecutive states, in seconds.
+     * @param maxSteps The maximum number of states to generate.
+     * @return The generated states, in order.
+     */
+    public List<CoupledState> generateAll(CoupledState initial, double dt, int maxSteps) {
+        double[] states = new double[maxSteps * CoupledStateBuffer.SIZE];
+        int count = generateBatch(initial, dt, maxSteps, states, null);
+
+        List<CoupledState> out = new ArrayList<>(count);
+        double[] arr = new double[CoupledStateBuffer.SIZE];
+        for (int i = 0; i < count; i++) {
+            System.arraycopy(states, i * CoupledStateBuffer.SIZE, arr, 0, CoupledStateBuffer.SIZE);
+            out.add(new CoupledState(arr));
+        }
+        return out;
+    }
+
     @Override
     public void close() {
         if (nativeCurveBuffer != 0L)
@@ -98,6 +183,21 @@ public class CoupledCausalTrajGen extends NativeResource {
         zeroHandle();
     }
 
+    // Set the profile, and reset the native curve buffer ready for new curves.
+    private void configureProfile(Profile profile) {
+        this.profile = profile;
+
+        if (profile instanceof NativeResource) {
+            this.nativeProfile = (NativeResource) profile;
+        } else {
+            throw new UnsupportedOperationException("Non-native profiles are not yet supported. See issue #11");
+        }
+
+        if (this.nativeCurveBuffer != 0L)
+            releaseBuffer(this.nativeCurveBuffer);
+        this.nativeCurveBuffer = acquireBuffer();
+    }
+
     private static void pack(long buffer, List<? extends Curve2d> curves) {
         for (Curve2d curve : curves) {
             if (curve instanceof INativeResource) {
@@ -115,6 +215,10 @@ public class CoupledCausalTrajGen extends NativeResource {
 
     private static native double[] generateNative(long h, long chassisHandle, long buf, long prof, double[] arr, double time);
 
+    private static native int generateBatchNative(long h, long chassisHandle, long buf, long prof, double[] initial, double dt, int maxSteps, double[] states, double[] wheels);
+
+    private static native void generateDirect(long h, long chassisHandle, long buf, long prof, ByteBuffer last, ByteBuffer output, double time);
+
     // Curve buffer
     private static native long acquireBuffer();
 
@@ -122,5 +226,7 @@ public class CoupledCausalTrajGen extends NativeResource {
 
     private static native void enqueueAdapter(long bufferHandle, Curve2d curve);
 
+    private static native void enqueueCurveBuffer(long bufferHandle, long curveBufferHandle);
+
     private static native void releaseBuffer(long bufferHandle);
 }
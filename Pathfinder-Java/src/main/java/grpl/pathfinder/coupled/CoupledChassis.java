@@ -36,11 +36,31 @@ public class CoupledChassis extends NativeResource {
      * @param mass        The mass of the chassis, in kilograms.
      */
     public CoupledChassis(DcTransmission left, DcTransmission right, double wheelRadius, double trackRadius, double mass) {
+        this(left, right, wheelRadius, trackRadius, mass, false);
+    }
+
+    /**
+     * Construct a coupled chassis, optionally taking a snapshot of transmissions implemented in Java.
+     * <p>
+     * Transmissions implemented in Java are otherwise called into for every evaluation, several times
+     * for each generated state. A snapshot is sampled once into native lookup tables, such that generation
+     * makes no calls into Java. See {@link JavaDcTransmissionAdapter#snapshot(DcTransmission)}.
+     * Native transmissions (such as {@link grpl.pathfinder.transmission.DcMotor}) are used directly.
+     * </p>
+     *
+     * @param left        The left side transmission.
+     * @param right       The right side transmission.
+     * @param wheelRadius The wheel radius, in metres.
+     * @param trackRadius The track radius, a.k.a half the chassis width, in metres.
+     * @param mass        The mass of the chassis, in kilograms.
+     * @param snapshot    Whether to take a snapshot of transmissions implemented in Java.
+     */
+    public CoupledChassis(DcTransmission left, DcTransmission right, double wheelRadius, double trackRadius, double mass, boolean snapshot) {
         super(allocateStub());
         this.transLeft = left;
         this.transRight = right;
-        this.nativeLeft = left instanceof NativeResource ? (NativeResource) left : new JavaDcTransmissionAdapter(left);
-        this.nativeRight = right instanceof NativeResource ? (NativeResource) right : new JavaDcTransmissionAdapter(right);
+        this.nativeLeft = adapt(left, snapshot);
+        this.nativeRight = adapt(right, snapshot);
         this.mass = mass;
         this.trackRadius = trackRadius;
         this.wheelRadius = wheelRadius;
@@ -149,6 +169,12 @@ public class CoupledChassis extends NativeResource {
             nativeRight.close();
     }
 
+    private static NativeResource adapt(DcTransmission transmission, boolean snapshot) {
+        if (transmission instanceof NativeResource)
+            return (NativeResource) transmission;
+        return snapshot ? JavaDcTransmissionAdapter.snapshot(transmission) : new JavaDcTransmissionAdapter(transmission);
+    }
+
     /* JNI */
     private static native long allocateStub();
 
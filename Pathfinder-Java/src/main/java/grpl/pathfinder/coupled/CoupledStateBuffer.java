@@ -0,0 +1,191 @@
+package grpl.pathfinder.coupled;
+
+import grpl.pathfinder.Vec2;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * A single {@link CoupledState}, held in a persistent direct buffer shared with native code.
+ * <p>
+ * Where {@link CoupledState} is copied to and from native code (allocating a new array and state on
+ * each call), a state buffer is read and written in place by the native library. Reusing a buffer for
+ * every call to {@link CoupledCausalTrajGen#generate(CoupledStateBuffer, CoupledStateBuffer, double)}
+ * means steady-state generation does not allocate on either the Java or the native side, avoiding
+ * garbage collection pauses in control loops.
+ * </p>
+ * <p>
+ * The buffer layout matches {@link CoupledState#toArray()}, in native byte order.
+ * </p>
+ */
+public class CoupledStateBuffer {
+
+    public static final int TIME = 0;
+    public static final int CURVATURE = 1;
+    public static final int DCURVATURE = 2;
+    public static final int X = 3;
+    public static final int Y = 4;
+    public static final int HEADING = 5;
+    public static final int DISTANCE = 6;
+    public static final int VELOCITY = 7;
+    public static final int ACCELERATION = 8;
+    public static final int FINISHED = 9;
+
+    /**
+     * The number of doubles in a state.
+     */
+    public static final int SIZE = 10;
+
+    private final ByteBuffer buffer;
+
+    /**
+     * Create a new state buffer, zeroed (the "initial conditions" of a trajectory starting at rest).
+     */
+    public CoupledStateBuffer() {
+        buffer = ByteBuffer.allocateDirect(SIZE * Double.BYTES).order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Create a new state buffer, holding a copy of a state.
+     *
+     * @param state The state to copy.
+     */
+    public CoupledStateBuffer(CoupledState state) {
+        this();
+        set(state);
+    }
+
+    /**
+     * @return The underlying direct buffer, in native byte order.
+     */
+    public ByteBuffer buffer() {
+        return buffer;
+    }
+
+    /**
+     * Get an element of the state.
+     *
+     * @param idx The index of the element, such as {@link #VELOCITY}.
+     * @return The value of the element.
+     */
+    public double get(int idx) {
+        return buffer.getDouble(idx * Double.BYTES);
+    }
+
+    /**
+     * Set an element of the state.
+     *
+     * @param idx   The index of the element, such as {@link #VELOCITY}.
+     * @param value The value of the element.
+     */
+    public void set(int idx, double value) {
+        buffer.putDouble(idx * Double.BYTES, value);
+    }
+
+    /**
+     * Copy a state into this buffer.
+     *
+     * @param state The state to copy.
+     */
+    public void set(CoupledState state) {
+        set(TIME, state.time);
+        set(CURVATURE, state.curvature);
+        set(DCURVATURE, state.dcurvature);
+        set(X, state.config.position.x());
+        set(Y, state.config.position.y());
+        set(HEADING, state.config.heading);
+        set(DISTANCE, state.kinematics.distance);
+        set(VELOCITY, state.kinematics.velocity);
+        set(ACCELERATION, state.kinematics.acceleration);
+        set(FINISHED, state.finished ? 1.0 : 0.0);
+    }
+
+    /**
+     * Copy another state buffer into this buffer.
+     *
+     * @param other The state buffer to copy.
+     */
+    public void set(CoupledStateBuffer other) {
+        for (int i = 0; i < SIZE; i++)
+            set(i, other.get(i));
+    }
+
+    /**
+     * @return A new {@link CoupledState} holding a copy of this buffer.
+     */
+    public CoupledState toState() {
+        return new CoupledState(
+                time(), curvature(), dcurvature(),
+                new CoupledConfigurationState(Vec2.cartesian(get(X), get(Y)), heading()),
+                new CoupledKinematicState(distance(), velocity(), acceleration()),
+                finished()
+        );
+    }
+
+    /**
+     * @return The time point of this state, in seconds.
+     */
+    public double time() {
+        return get(TIME);
+    }
+
+    /**
+     * @return The instantaneous curvature of the state, in m^-1
+     */
+    public double curvature() {
+        return get(CURVATURE);
+    }
+
+    /**
+     * @return The instantaneous change in curvature of the state, in m^-2 (dk/ds)
+     */
+    public double dcurvature() {
+        return get(DCURVATURE);
+    }
+
+    /**
+     * @return The x position of the centre of the drivetrain, in metres.
+     */
+    public double x() {
+        return get(X);
+    }
+
+    /**
+     * @return The y position of the centre of the drivetrain, in metres.
+     */
+    public double y() {
+        return get(Y);
+    }
+
+    /**
+     * @return The heading of the drivetrain, in radians.
+     */
+    public double heading() {
+        return get(HEADING);
+    }
+
+    /**
+     * @return The distance covered by the drivetrain, in metres.
+     */
+    public double distance() {
+        return get(DISTANCE);
+    }
+
+    /**
+     * @return The linear velocity of the drivetrain, in metres per second (ms^-1).
+     */
+    public double velocity() {
+        return get(VELOCITY);
+    }
+
+    /**
+     * @return The linear acceleration of the drivetrain, in metres per second per second (ms^-2).
+     */
+    public double acceleration() {
+        return get(ACCELERATION);
+    }
+
+    public boolean finished() {
+        return get(FINISHED) > 0.5;
+    }
+}
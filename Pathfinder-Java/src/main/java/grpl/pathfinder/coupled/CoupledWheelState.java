@@ -8,6 +8,11 @@ import grpl.pathfinder.Vec2;
  */
 public class CoupledWheelState {
 
+    /**
+     * The number of doubles in the array representation of a wheel state, see {@link #toArray()}.
+     */
+    public static final int SIZE = 9;
+
     /**
      * The time point of this state, in seconds.
      */
@@ -0,0 +1,278 @@
+package grpl.pathfinder.coupled;
+
+import grpl.pathfinder.path.ArcParameterizer;
+import grpl.pathfinder.path.HermiteQuintic;
+import grpl.pathfinder.profile.Profile;
+import grpl.pathfinder.util.NativeResource;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.util.List;
+
+/**
+ * A full trajectory of a coupled drivetrain, held in native memory.
+ * <p>
+ * The trajectory is stored in structure-of-arrays form: each quantity (such as {@link #TIME} or
+ * {@link #VELOCITY}) is a contiguous column, exposed as a read-only {@link DoubleBuffer} directly over the
+ * native memory. Reading the trajectory does not copy it, or allocate a {@link CoupledState} (and its
+ * nested configuration and kinematic states) per state, so a long trajectory creates no garbage. Columns
+ * are suited to bulk operations, such as streaming the left and right voltages to motor controllers.
+ * </p>
+ * <p>
+ * The native memory is released when the trajectory is closed, after which any buffer previously
+ * returned by {@link #column(int)} (or its named equivalents) must not be used.
+ * </p>
+ */
+public class Trajectory extends NativeResource {
+
+    /**
+     * The time of each state, in seconds.
+     */
+    public static final int TIME = 0;
+    /**
+     * The x position of the centre of the chassis at each state, in metres.
+     */
+    public static final int X = 1;
+    /**
+     * The y position of the centre of the chassis at each state, in metres.
+     */
+    public static final int Y = 2;
+    /**
+     * The heading of the chassis at each state, in radians.
+     */
+    public static final int HEADING = 3;
+    /**
+     * The distance travelled along the path at each state, in metres.
+     */
+    public static final int DISTANCE = 4;
+    /**
+     * The linear velocity of the centre of the chassis at each state, in metres per second.
+     */
+    public static final int VELOCITY = 5;
+    /**
+     * The linear acceleration of the centre of the chassis at each state, in metres per second per second.
+     */
+    public static final int ACCELERATION = 6;
+    /**
+     * The curvature of the path at each state, in inverse metres.
+     */
+    public static final int CURVATURE = 7;
+    /**
+     * The rate of change of curvature with respect to distance at each state.
+     */
+    public static final int DCURVATURE = 8;
+    /**
+     * The voltage applied to the left transmission at each state, in Volts.
+     */
+    public static final int LEFT_VOLTAGE = 9;
+    /**
+     * The voltage applied to the right transmission at each state, in Volts.
+     */
+    public static final int RIGHT_VOLTAGE = 10;
+
+    /**
+     * The number of columns.
+     */
+    public static final int COLUMNS = 11;
+
+    private static final DoubleBuffer EMPTY = DoubleBuffer.allocate(0);
+
+    private final int size;
+    private final DoubleBuffer[] columns = new DoubleBuffer[COLUMNS];
+
+    Trajectory(long handle) {
+        super(handle);
+        ByteBuffer data = data(handle);
+        this.size = data == null ? 0 : data.capacity() / (COLUMNS * Double.BYTES);
+        for (int c = 0; c < COLUMNS; c++)
+            columns[c] = data == null ? EMPTY : slice(data, c, size);
+    }
+
+    /**
+     * Generate a full trajectory from waypoints on the calling thread, in a single native call.
+     * <p>
+     * The splines are fit, parameterized and the trajectory generated entirely in native code, without
+     * constructing a Java (or native handle) object for each spline, curve or state. See
+     * {@link CoupledAsyncTrajGen} to generate in the background instead.
+     * </p>
+     *
+     * @param chassis   The coupled chassis, used to provide limits for the trajectory kinematics.
+     * @param waypoints The waypoints of the path, flattened as by
+     *                  {@link HermiteQuintic.Waypoint#flatten(List)}.
+     * @param param     The arc parameterizer to parameterize the splines with.
+     * @param profile   The profile to use for the trajectory. Must be a native profile, such as
+     *                  {@link grpl.pathfinder.profile.TrapezoidalProfile}.
+     * @param dt        The timestep between states of the trajectory, in seconds.
+     * @param timeout   The maximum duration of the trajectory, in seconds. Trajectories that take longer are
+     *                  returned unfinished (see {@link #finished()}).
+     * @return The trajectory. The caller is responsible for closing it.
+     */
+    public static Trajectory generate(CoupledChassis chassis, double[] waypoints, ArcParameterizer param,
+                                      Profile profile, double dt, double timeout) {
+        if (!(profile instanceof NativeResource))
+            throw new UnsupportedOperationException("Non-native profiles are not yet supported. See issue #11");
+        if (waypoints.length % HermiteQuintic.Waypoint.SIZE != 0)
+            throw new IllegalArgumentException("Waypoints must be " + HermiteQuintic.Waypoint.SIZE + " doubles each");
+
+        return new Trajectory(generate(chassis.nativeHandle(), param.nativeHandle(),
+                ((NativeResource) profile).nativeHandle(), waypoints, dt, timeout));
+    }
+
+    /**
+     * Generate a full trajectory from waypoints on the calling thread, in a single native call, with a
+     * timeout of {@link CoupledAsyncTrajGen#DEFAULT_TIMEOUT}.
+     * <p>
+     * See {@link #generate(CoupledChassis, double[], ArcParameterizer, Profile, double, double)}.
+     * </p>
+     */
+    public static Trajectory generate(CoupledChassis chassis,
+                                      List<? extends HermiteQuintic.Waypoint> waypoints,
+                                      ArcParameterizer param, Profile profile, double dt) {
+        return generate(chassis, HermiteQuintic.Waypoint.flatten(waypoints), param, profile, dt,
+                CoupledAsyncTrajGen.DEFAULT_TIMEOUT);
+    }
+
+    private static DoubleBuffer slice(ByteBuffer data, int column, int size) {
+        ByteBuffer buffer = data.duplicate();
+        buffer.limit((column + 1) * size * Double.BYTES);
+        buffer.position(column * size * Double.BYTES);
+        return buffer.slice().order(ByteOrder.nativeOrder()).asDoubleBuffer().asReadOnlyBuffer();
+    }
+
+    /**
+     * @return The number of states in the trajectory.
+     */
+    public int size() {
+        return size;
+    }
+
+    /**
+     * @return Whether the trajectory reached the end of the path.
+     */
+    public boolean finished() {
+        return finished(nativeHandle());
+    }
+
+    /**
+     * Get a column of the trajectory.
+     *
+     * @param column The column, such as {@link #VELOCITY}.
+     * @return A read-only view of the column in native memory, holding one value per state. The view is
+     * shared, so use absolute gets (or {@link DoubleBuffer#duplicate()}) if sharing between threads.
+     */
+    public DoubleBuffer column(int column) {
+        return columns[column];
+    }
+
+    /**
+     * @return The {@link #TIME} column.
+     */
+    public DoubleBuffer time() {
+        return columns[TIME];
+    }
+
+    /**
+     * @return The {@link #X} column.
+     */
+    public DoubleBuffer x() {
+        return columns[X];
+    }
+
+    /**
+     * @return The {@link #Y} column.
+     */
+    public DoubleBuffer y() {
+        return columns[Y];
+    }
+
+    /**
+     * @return The {@link #HEADING} column.
+     */
+    public DoubleBuffer heading() {
+        return columns[HEADING];
+    }
+
+    /**
+     * @return The {@link #DISTANCE} column.
+     */
+    public DoubleBuffer distance() {
+        return columns[DISTANCE];
+    }
+
+    /**
+     * @return The {@link #VELOCITY} column.
+     */
+    public DoubleBuffer velocity() {
+        return columns[VELOCITY];
+    }
+
+    /**
+     * @return The {@link #ACCELERATION} column.
+     */
+    public DoubleBuffer acceleration() {
+        return columns[ACCELERATION];
+    }
+
+    /**
+     * @return The {@link #CURVATURE} column.
+     */
+    public DoubleBuffer curvature() {
+        return columns[CURVATURE];
+    }
+
+    /**
+     * @return The {@link #LEFT_VOLTAGE} column.
+     */
+    public DoubleBuffer leftVoltage() {
+        return columns[LEFT_VOLTAGE];
+    }
+
+    /**
+     * @return The {@link #RIGHT_VOLTAGE} column.
+     */
+    public DoubleBuffer rightVoltage() {
+        return columns[RIGHT_VOLTAGE];
+    }
+
+    /**
+     * Get a value of the trajectory.
+     *
+     * @param column The column, such as {@link #VELOCITY}.
+     * @param idx    The index of the state.
+     * @return The value of the column at the state.
+     */
+    public double get(int column, int idx) {
+        return columns[column].get(idx);
+    }
+
+    /**
+     * @param idx The index of the state.
+     * @return A new {@link CoupledState} holding a copy of the state.
+     */
+    public CoupledState state(int idx) {
+        return new CoupledState(
+                get(TIME, idx), get(CURVATURE, idx), get(DCURVATURE, idx),
+                new CoupledConfigurationState(get(X, idx), get(Y, idx), get(HEADING, idx)),
+                new CoupledKinematicState(get(DISTANCE, idx), get(VELOCITY, idx), get(ACCELERATION, idx)),
+                idx == size - 1 && finished()
+        );
+    }
+
+    @Override
+    public void close() {
+        for (int c = 0; c < COLUMNS; c++)
+            columns[c] = EMPTY;
+        free(nativeHandle());
+        zeroHandle();
+    }
+
+    /* JNI */
+    private static native long generate(long chassisHandle, long paramHandle, long profileHandle, double[] waypoints, double dt, double timeout);
+
+    private static native void free(long h);
+
+    private static native boolean finished(long h);
+
+    private static native ByteBuffer data(long h);
+}
@@ -0,0 +1,103 @@
+package grpl.pathfinder.coupled;
+
+import grpl.pathfinder.profile.Profile;
+import grpl.pathfinder.util.NativeResource;
+
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.TimeoutException;
+
+/**
+ * A {@link Trajectory} being generated in the background by a {@link CoupledAsyncTrajGen}.
+ * <p>
+ * {@link #isDone()} never blocks, so may be polled from a control loop. Once done, {@link #get()} returns
+ * the trajectory without blocking (or throws {@link CancellationException} if the request was cancelled).
+ * </p>
+ * <p>
+ * Closing the future cancels the request if it is not yet done, waiting for it to stop if it is running.
+ * The trajectory returned by {@link #get()} is owned by the caller and remains valid after the future is
+ * closed.
+ * </p>
+ */
+public class TrajectoryFuture extends NativeResource implements Future<Trajectory> {
+
+    // Must match grpl::pf::util::task_executor::status
+    private static final int PENDING = 0, RUNNING = 1, COMPLETED = 2, CANCELLED = 3;
+
+    // The chassis and profile are in use by the native task, so must remain reachable.
+    private CoupledChassis chassis;
+    private Profile profile;
+    private Trajectory result;
+
+    TrajectoryFuture(long handle, CoupledChassis chassis, Profile profile) {
+        super(handle);
+        this.chassis = chassis;
+        this.profile = profile;
+    }
+
+    /**
+     * @return Whether the request is waiting to run.
+     */
+    public boolean isPending() {
+        return status(nativeHandle()) == PENDING;
+    }
+
+    @Override
+    public boolean cancel(boolean mayInterruptIfRunning) {
+        if (!mayInterruptIfRunning && status(nativeHandle()) == RUNNING)
+            return false;
+        return cancel(nativeHandle());
+    }
+
+    @Override
+    public boolean isCancelled() {
+        return status(nativeHandle()) == CANCELLED;
+    }
+
+    @Override
+    public boolean isDone() {
+        int status = status(nativeHandle());
+        return status == COMPLETED || status == CANCELLED;
+    }
+
+    @Override
+    public Trajectory get() {
+        await(nativeHandle(), -1);
+        return result();
+    }
+
+    @Override
+    public Trajectory get(long timeout, TimeUnit unit) throws TimeoutException {
+        if (!await(nativeHandle(), Math.max(0, unit.toNanos(timeout))))
+            throw new TimeoutException();
+        return result();
+    }
+
+    @Override
+    public void close() {
+        free(nativeHandle());
+        zeroHandle();
+    }
+
+    private synchronized Trajectory result() {
+        if (result == null) {
+            long handle = take(nativeHandle());
+            if (handle == 0L)
+                throw new CancellationException();
+            result = new Trajectory(handle);
+        }
+        return result;
+    }
+
+    /* JNI */
+    private static native void free(long h);
+
+    private static native int status(long h);
+
+    private static native boolean cancel(long h);
+
+    private static native boolean await(long h, long timeoutNanos);
+
+    private static native long take(long h);
+}
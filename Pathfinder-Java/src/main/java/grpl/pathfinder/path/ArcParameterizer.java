@@ -46,6 +46,60 @@ public class ArcParameterizer extends NativeResource {
         return list;
     }
 
+    /**
+     * Parameterize a container of splines into augmented 2D arcs, held in a single native buffer.
+     * <p>
+     * Unlike {@link #parameterize(List)}, the arcs are not allocated or wrapped individually, which is
+     * considerably cheaper for long paths. The buffer may be passed directly to a trajectory generator.
+     * </p>
+     *
+     * @param splines A list of splines to parameterize
+     * @return The buffer of curves generated from the splines. The caller is responsible for closing it.
+     */
+    public CurveBuffer parameterizeToBuffer(List<? extends Spline2d> splines) {
+        long buffer = pack(splines);
+        try {
+            return new CurveBuffer(parameterizeToBuffer(nativeHandle(), buffer));
+        }
+        finally {
+            releaseBuffer(buffer);
+        }
+    }
+
+    /**
+     * Fit quintic hermite splines through waypoints and parameterize them into augmented 2D arcs, held in a
+     * single native buffer.
+     * <p>
+     * The splines are generated and parameterized in native code in a single call, without constructing a
+     * {@link HermiteQuintic} (and its native handle) for each segment. This is equivalent to, but much
+     * cheaper than, calling {@link #parameterizeToBuffer(List)} with the splines of
+     * {@link HermiteFactory#generateQuintic(List)}.
+     * </p>
+     *
+     * @param waypoints The waypoints of the path, flattened as by
+     *                  {@link HermiteQuintic.Waypoint#flatten(List)}.
+     * @return The buffer of curves generated from the waypoints. The caller is responsible for closing it.
+     */
+    public CurveBuffer parameterizeWaypoints(double[] waypoints) {
+        if (waypoints.length % HermiteQuintic.Waypoint.SIZE != 0)
+            throw new IllegalArgumentException("Waypoints must be " + HermiteQuintic.Waypoint.SIZE + " doubles each");
+        return new CurveBuffer(parameterizeWaypoints(nativeHandle(), waypoints));
+    }
+
+    /**
+     * Fit quintic hermite splines through waypoints and parameterize them into augmented 2D arcs, held in a
+     * single native buffer.
+     * <p>
+     * See {@link #parameterizeWaypoints(double[])}.
+     * </p>
+     *
+     * @param waypoints The waypoints of the path.
+     * @return The buffer of curves generated from the waypoints. The caller is responsible for closing it.
+     */
+    public CurveBuffer parameterizeWaypoints(List<? extends HermiteQuintic.Waypoint> waypoints) {
+        return parameterizeWaypoints(HermiteQuintic.Waypoint.flatten(waypoints));
+    }
+
     /**
      * Configure the parameters for the parameterizer, which are used as the criteria for deciding
      * when to produce a new arc.
@@ -89,6 +143,10 @@ public class ArcParameterizer extends NativeResource {
 
     private static native long[] parameterize(long handle, long buffer);
 
+    private static native long parameterizeToBuffer(long handle, long buffer);
+
+    private static native long parameterizeWaypoints(long handle, double[] waypoints);
+
     private static native long acquireBuffer();
 
     private static native void enqueueNative(long bufferHandle, long splineHandle);
@@ -0,0 +1,87 @@
+package grpl.pathfinder.path;
+
+import grpl.pathfinder.util.NativeResource;
+
+/**
+ * A native buffer of curves, held in a single contiguous allocation owned by a single handle.
+ * <p>
+ * Where {@link ArcParameterizer#parameterize(java.util.List)} allocates each arc separately and wraps each
+ * in its own Java object, a curve buffer keeps all arcs of a path in native memory, and is passed to the
+ * trajectory generator as a whole (see
+ * {@link grpl.pathfinder.coupled.CoupledCausalTrajGen#configure(CurveBuffer, grpl.pathfinder.profile.Profile)}).
+ * The curves are accessed in bulk, with a single native call for any number of curves or samples.
+ * </p>
+ * <p>
+ * Curve buffers are created by {@link ArcParameterizer#parameterizeToBuffer(java.util.List)}. The buffer
+ * must remain open while any trajectory generator configured with it is in use.
+ * </p>
+ */
+public class CurveBuffer extends NativeResource {
+
+    /**
+     * The number of doubles in each sample of {@link #sample(double[], double[])}.
+     */
+    public static final int SAMPLE_SIZE = 4;
+
+    CurveBuffer(long handle) {
+        super(handle);
+    }
+
+    /**
+     * @return The number of curves in the buffer.
+     */
+    public int size() {
+        return size(nativeHandle());
+    }
+
+    /**
+     * @return The length of each curve in the buffer, in metres.
+     */
+    public double[] lengths() {
+        double[] out = new double[size()];
+        lengths(nativeHandle(), out);
+        return out;
+    }
+
+    /**
+     * @return The total length of all curves in the buffer, in metres.
+     */
+    public double length() {
+        double length = 0;
+        for (double l : lengths())
+            length += l;
+        return length;
+    }
+
+    /**
+     * Sample the path at many distances along it, in a single native call.
+     * <p>
+     * Each sample is {@link #SAMPLE_SIZE} doubles: the x and y position in metres, the heading in radians,
+     * and the curvature in m^-1.
+     * </p>
+     *
+     * @param distances The distances along the path (the curves end-to-end), in metres. Sampling is
+     *                  fastest if the distances are increasing.
+     * @param out       The output array, of at least {@link #SAMPLE_SIZE} * distances.length doubles.
+     */
+    public void sample(double[] distances, double[] out) {
+        if (out.length < SAMPLE_SIZE * distances.length)
+            throw new IllegalArgumentException("Output array is too small for " + distances.length + " samples");
+        sample(nativeHandle(), distances, out);
+    }
+
+    @Override
+    public void close() {
+        free(nativeHandle());
+        zeroHandle();
+    }
+
+    /* JNI */
+    private static native void free(long h);
+
+    private static native int size(long h);
+
+    private static native void lengths(long h, double[] out);
+
+    private static native void sample(long h, double[] distances, double[] out);
+}
@@ -2,6 +2,8 @@ package grpl.pathfinder.path;
 
 import grpl.pathfinder.Vec2;
 
+import java.util.List;
+
 /**
  * Implementation of a quintic (order 5) hermite spline.
  *
@@ -25,6 +27,11 @@ public class HermiteQuintic extends AbstractSpline2d {
      */
     public static class Waypoint {
 
+        /**
+         * The number of doubles in a waypoint, in the layout of {@link #flatten(List)}.
+         */
+        public static final int SIZE = 6;
+
         /**
          * The 2D position of the waypoint, in metres. Ordered x, y.
          */
@@ -53,6 +60,20 @@ public class HermiteQuintic extends AbstractSpline2d {
                 dtangent.x(), dtangent.y()
             };
         }
+
+        /**
+         * Flatten waypoints into a single array, for passing to the native library in one call.
+         *
+         * @param waypoints The waypoints to flatten.
+         * @return The waypoints, each of {@link #SIZE} doubles: the position, tangent and change in tangent,
+         * each x then y.
+         */
+        public static double[] flatten(List<? extends Waypoint> waypoints) {
+            double[] out = new double[waypoints.size() * SIZE];
+            for (int i = 0; i < waypoints.size(); i++)
+                System.arraycopy(waypoints.get(i).toNative(), 0, out, i * SIZE, SIZE);
+            return out;
+        }
     }
 
     private static native long allocate(double[] start, double[] end);
@@ -11,6 +11,11 @@ import grpl.pathfinder.Vec2;
  */
 public interface Spline2d {
 
+    /**
+     * The number of doubles in each sample of {@link #sample(double[], double[])}.
+     */
+    int SAMPLE_SIZE = 5;
+
     /**
      * Calculate the position of a point on the spline, at any spline parameter
      * value 't'
@@ -50,4 +55,31 @@ public interface Spline2d {
      */
     double curvature(double t);
 
+    /**
+     * Sample the spline at many spline parameter values 't' at once.
+     * <p>
+     * Each sample is {@link #SAMPLE_SIZE} doubles: the x and y position in m, the x and y derivative
+     * in m/t, and the curvature in m^-1. This is used by the native library to evaluate splines
+     * implemented in Java with a single call, rather than a call for every evaluation. The default
+     * implementation calls {@link #position(double)}, {@link #derivative(double)} and
+     * {@link #curvature(double)} for each value of 't'. Implementations may override this with a
+     * more efficient (non-allocating) evaluation.
+     * </p>
+     *
+     * @param t   The spline parameters to sample at, where 0 is the start and 1 is the end of the
+     *            spline.
+     * @param out The output array, of at least {@link #SAMPLE_SIZE} * t.length doubles.
+     */
+    default void sample(double[] t, double[] out) {
+        for (int i = 0; i < t.length; i++) {
+            Vec2 pos = position(t[i]);
+            Vec2 deriv = derivative(t[i]);
+            out[i * SAMPLE_SIZE] = pos.x();
+            out[i * SAMPLE_SIZE + 1] = pos.y();
+            out[i * SAMPLE_SIZE + 2] = deriv.x();
+            out[i * SAMPLE_SIZE + 3] = deriv.y();
+            out[i * SAMPLE_SIZE + 4] = curvature(t[i]);
+        }
+    }
+
 }
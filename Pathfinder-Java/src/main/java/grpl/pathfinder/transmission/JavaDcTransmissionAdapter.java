@@ -2,12 +2,70 @@ package grpl.pathfinder.transmission;
 
 import grpl.pathfinder.util.NativeResource;
 
+/**
+ * Native adapter for a {@link DcTransmission} implemented in Java.
+ * <p>
+ * By default, the adapter calls into the Java transmission for every evaluation. Since the chassis
+ * evaluates its transmissions several times for every generated state, this is slow. A snapshot
+ * adapter (see {@link #snapshot(DcTransmission)}) instead samples the Java transmission once into native
+ * lookup tables, and makes no calls into Java afterwards. Snapshots are exact for linear transmissions
+ * (such as {@link DcMotor}), and interpolate linearly between samples otherwise.
+ * </p>
+ * <p>
+ * Both kinds of adapter may be used from native worker threads.
+ * </p>
+ */
 public class JavaDcTransmissionAdapter extends AbstractDcTransmission {
 
+    /**
+     * The default number of samples of each lookup table of a snapshot.
+     */
+    public static final int DEFAULT_SNAPSHOT_SAMPLES = 65;
+
+    /**
+     * Create an adapter that calls into the Java transmission for every evaluation.
+     *
+     * @param transmission The Java transmission.
+     */
     public  JavaDcTransmissionAdapter(DcTransmission transmission) {
         super(allocate(transmission));
     }
 
+    private JavaDcTransmissionAdapter(long handle) {
+        super(handle);
+    }
+
+    /**
+     * Create an adapter from a snapshot of the Java transmission, with the default number of samples.
+     *
+     * @param transmission The Java transmission. Changes to the transmission after this call are not
+     *                     reflected by the snapshot.
+     * @return The snapshot adapter.
+     */
+    public static JavaDcTransmissionAdapter snapshot(DcTransmission transmission) {
+        return snapshot(transmission, DEFAULT_SNAPSHOT_SAMPLES);
+    }
+
+    /**
+     * Create an adapter from a snapshot of the Java transmission.
+     * <p>
+     * Each function of the transmission is sampled uniformly over twice its nominal range (nominal
+     * voltage, free speed, stall current and stall torque), and extrapolated linearly beyond it.
+     * </p>
+     *
+     * @param transmission The Java transmission. Changes to the transmission after this call are not
+     *                     reflected by the snapshot.
+     * @param samples      The number of samples of each lookup table, at least 2.
+     * @return The snapshot adapter.
+     */
+    public static JavaDcTransmissionAdapter snapshot(DcTransmission transmission, int samples) {
+        if (samples < 2)
+            throw new IllegalArgumentException("Snapshot requires at least 2 samples");
+        return new JavaDcTransmissionAdapter(allocateSnapshot(transmission, samples));
+    }
+
     private static native long allocate(DcTransmission javaTransmission);
 
+    private static native long allocateSnapshot(DcTransmission javaTransmission, int samples);
+
 }
@@ -0,0 +1,15 @@
+package grpl.pathfinder.util;
+
+/**
+ * Thrown by the native library when a {@link NativeResource} is used after it is closed.
+ * <p>
+ * Native handles are checked against a table of live objects on each native call, so a closed (or
+ * otherwise invalid) handle raises this exception rather than accessing freed native memory.
+ * </p>
+ */
+public class ClosedException extends IllegalStateException {
+
+    public ClosedException(String message) {
+        super(message);
+    }
+}
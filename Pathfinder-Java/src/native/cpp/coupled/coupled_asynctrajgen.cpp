@@ -0,0 +1,40 @@
+#include "grpl_pathfinder_coupled_CoupledAsyncTrajGen.h"
+#include "jnihandle.h"
+#include "coupled/jnicoupled.h"
+#include "path/jnipath.h"
+
+#include <grpl/pf/util/task_executor.h>
+
+#include <memory>
+
+using namespace grpl::pf;
+
+JNIEXPORT jlong JNICALL Java_grpl_pathfinder_coupled_CoupledAsyncTrajGen_allocate(JNIEnv *env, jclass claz,
+                                                                                  jint workers) {
+  return jni_as_handle<util::task_executor>(new util::task_executor(static_cast<size_t>(workers)));
+}
+
+JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledAsyncTrajGen_free(JNIEnv *env, jclass claz,
+                                                                             jlong handle) {
+  delete jni_release_handle<util::task_executor>(env, handle);
+}
+
+JNIEXPORT jlong JNICALL Java_grpl_pathfinder_coupled_CoupledAsyncTrajGen_submit(
+    JNIEnv *env, jclass claz, jlong handle, jlong chassisHandle, jlong paramHandle, jlong profileHandle,
+    jdoubleArray waypoints, jdouble dt, jdouble timeout, jboolean urgent) {
+  util::task_executor *    exec  = jni_handle<util::task_executor>(env, handle);
+  coupled::chassis *       ch    = jni_handle<coupled::chassis>(env, chassisHandle);
+  path::arc_parameterizer *param = jni_handle<path::arc_parameterizer>(env, paramHandle);
+  profile::profile *       prof  = jni_handle<profile::profile>(env, profileHandle);
+  if (exec == nullptr || ch == nullptr || param == nullptr || prof == nullptr) return 0;
+
+  auto req = std::make_shared<jni_trajectory_request>(jni_trajectory_request{
+      jni_path_quintic_waypoints(env, waypoints), *param, ch, prof, prof->get_context(), dt, timeout});
+  auto result = std::make_shared<jni_trajectory>();
+
+  auto task = exec->submit(
+      [req, result](util::task_executor::task &self) { jni_trajectory_generate(*req, &self, *result); },
+      urgent ? util::task_executor::priority::urgent : util::task_executor::priority::normal);
+
+  return jni_as_handle<jni_trajectory_future>(new jni_trajectory_future{task, result});
+}
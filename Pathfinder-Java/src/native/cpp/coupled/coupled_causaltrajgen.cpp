@@ -3,11 +3,13 @@
 #include "jnihandle.h"
 #include "jniutil.h"
 #include "coupled/jnicoupled.h"
+#include "path/jnipath.h"
 
 #include <grpl/pf/coupled/causal_trajectory_generator.h>
 #include <grpl/pf/path/curve.h>
 #include <grpl/pf/profile/profile.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -16,17 +18,10 @@ using namespace grpl::pf;
 using curve_container_t = std::vector<std::reference_wrapper<path::curve<2>>>;
 
 static jdoubleArray state_to_java(JNIEnv *env, coupled::state &st) {
-  double tmp_state_arr[10];
-  jdoubleArray nArr = env->NewDoubleArray(10);
-  tmp_state_arr[0]  = st.time;
-  tmp_state_arr[1]  = st.curvature;
-  tmp_state_arr[2]  = st.dcurvature;
-  for (int i = 0; i < 3; i++) {
-    tmp_state_arr[3 + i] = st.config[i];
-    tmp_state_arr[6 + i] = st.kinematics[i];
-  }
-  tmp_state_arr[9] = st.finished ? 1.0 : 0.0;
-  env->SetDoubleArrayRegion(nArr, 0, 10, tmp_state_arr);
+  double       tmp_state_arr[jni_coupled_state_size];
+  jdoubleArray nArr = env->NewDoubleArray(jni_coupled_state_size);
+  jni_coupled_state_to_buffer(st, tmp_state_arr);
+  env->SetDoubleArrayRegion(nArr, 0, jni_coupled_state_size, tmp_state_arr);
   return nArr;
 }
 
@@ -36,7 +31,7 @@ JNIEXPORT jlong JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_alloca
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_free(JNIEnv *env, jclass claz,
                                                                               jlong handle) {
-  delete jni_handle<coupled::causal_trajectory_generator>(env, handle);
+  delete jni_release_handle<coupled::causal_trajectory_generator>(env, handle);
 }
 
 JNIEXPORT jdoubleArray JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_generateNative(
@@ -54,6 +49,73 @@ JNIEXPORT jdoubleArray JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen
   return state_to_java(env, n);
 }
 
+JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_generateDirect(
+    JNIEnv *env, jclass claz, jlong handle, jlong chassisHandle, jlong buff, jlong profile_handle,
+    jobject lastBuffer, jobject outBuffer, jdouble time) {
+  double *last_addr = jni_coupled_direct_state(env, lastBuffer);
+  if (last_addr == nullptr) return;
+  double *out_addr = jni_coupled_direct_state(env, outBuffer);
+  if (out_addr == nullptr) return;
+
+  curve_container_t *curves = jni_handle<curve_container_t>(env, buff);
+
+  profile::profile *prof = jni_handle<profile::profile>(env, profile_handle);
+  coupled::chassis *ch   = jni_handle<coupled::chassis>(env, chassisHandle);
+
+  // The last state is read before the output is written, so the buffers may be the same.
+  coupled::state s = jni_coupled_buffer_to_state(last_addr);
+  coupled::state n = jni_handle<coupled::causal_trajectory_generator>(env, handle)
+                         ->generate(*ch, curves->begin(), curves->end(), *prof, s, time);
+
+  jni_coupled_state_to_buffer(n, out_addr);
+}
+
+JNIEXPORT jint JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_generateBatchNative(
+    JNIEnv *env, jclass claz, jlong handle, jlong chassisHandle, jlong buff, jlong profile_handle,
+    jdoubleArray initialArr, jdouble dt, jint maxSteps, jdoubleArray statesArr, jdoubleArray wheelsArr) {
+  curve_container_t *curves = jni_handle<curve_container_t>(env, buff);
+
+  profile::profile *prof = jni_handle<profile::profile>(env, profile_handle);
+  coupled::chassis *ch   = jni_handle<coupled::chassis>(env, chassisHandle);
+
+  coupled::causal_trajectory_generator *gen =
+      jni_handle<coupled::causal_trajectory_generator>(env, handle);
+
+  coupled::state s = jni_coupled_java_to_state(env, initialArr);
+
+  jint steps = std::min<jint>(maxSteps, env->GetArrayLength(statesArr) / jni_coupled_state_size);
+  if (wheelsArr != nullptr)
+    steps = std::min<jint>(steps, env->GetArrayLength(wheelsArr) / (2 * jni_coupled_wheel_state_size));
+
+  // No JNI calls may be made while the arrays are held, so everything above is resolved first.
+  double *states = static_cast<double *>(env->GetPrimitiveArrayCritical(statesArr, nullptr));
+  double *wheels = nullptr;
+  if (wheelsArr != nullptr)
+    wheels = static_cast<double *>(env->GetPrimitiveArrayCritical(wheelsArr, nullptr));
+
+  jint count = 0;
+  if (states != nullptr && (wheelsArr == nullptr || wheels != nullptr)) {
+    double start = s.time;
+    while (count < steps && !s.finished) {
+      // Time is calculated from the initial state, such that error in dt does not accumulate.
+      s = gen->generate(*ch, curves->begin(), curves->end(), *prof, s, start + (count + 1) * dt);
+      jni_coupled_state_to_buffer(s, states + count * jni_coupled_state_size);
+
+      if (wheels != nullptr) {
+        std::pair<coupled::wheel_state, coupled::wheel_state> split = ch->split(s);
+        double *wheel = wheels + count * 2 * jni_coupled_wheel_state_size;
+        jni_coupled_wheel_state_to_buffer(split.first, wheel);
+        jni_coupled_wheel_state_to_buffer(split.second, wheel + jni_coupled_wheel_state_size);
+      }
+      count++;
+    }
+  }
+
+  if (wheels != nullptr) env->ReleasePrimitiveArrayCritical(wheelsArr, wheels, 0);
+  if (states != nullptr) env->ReleasePrimitiveArrayCritical(statesArr, states, 0);
+  return count;
+}
+
 JNIEXPORT jlong JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_acquireBuffer(JNIEnv *env,
                                                                                         jclass  claz) {
   return jni_as_handle<curve_container_t>(new curve_container_t());
@@ -69,6 +131,15 @@ JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_enqueue
   curves->push_back(*cur);
 }
 
+JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_enqueueCurveBuffer(
+    JNIEnv *env, jclass claz, jlong buff, jlong curveBufferHandle) {
+  curve_container_t * curves = jni_handle<curve_container_t>(env, buff);
+  jni_curve_buffer_t *arena  = jni_handle<jni_curve_buffer_t>(env, curveBufferHandle);
+
+  curves->reserve(curves->size() + arena->size());
+  for (auto &c : *arena) curves->push_back(c);
+}
+
 JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_enqueueAdapter(JNIEnv *env,
                                                                                         jclass  claz,
                                                                                         jlong   buff,
@@ -79,5 +150,5 @@ JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_enqueue
 JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledCausalTrajGen_releaseBuffer(JNIEnv *env,
                                                                                        jclass  claz,
                                                                                        jlong   buff) {
-  delete jni_handle<curve_container_t>(env, buff);
+  delete jni_release_handle<curve_container_t>(env, buff);
 }
\ No newline at end of file
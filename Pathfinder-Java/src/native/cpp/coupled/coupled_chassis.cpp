@@ -21,17 +21,9 @@ using traits_t    = std::allocator_traits<allocator_t>;
 allocator_t _ch_alloc;
 
 static void wheelstate_to_java(JNIEnv *env, wheel_state &ws, jdoubleArray arr) {
-  double tmp_state_arr[10];
-  tmp_state_arr[0] = ws.time;
-  tmp_state_arr[1] = ws.position[0];
-  tmp_state_arr[2] = ws.position[1];
-  for (int i = 0; i < 3; i++) {
-    tmp_state_arr[3 + i] = ws.kinematics[i];
-  }
-  tmp_state_arr[6] = ws.voltage;
-  tmp_state_arr[7] = ws.current;
-  tmp_state_arr[8] = ws.finished ? 1.0 : 0.0;
-  env->SetDoubleArrayRegion(arr, 0, 9, tmp_state_arr);
+  double tmp_state_arr[jni_coupled_wheel_state_size];
+  jni_coupled_wheel_state_to_buffer(ws, tmp_state_arr);
+  env->SetDoubleArrayRegion(arr, 0, jni_coupled_wheel_state_size, tmp_state_arr);
 }
 
 JNIEXPORT jlong JNICALL Java_grpl_pathfinder_coupled_CoupledChassis_allocateStub(JNIEnv *env, jclass claz) {
@@ -51,7 +43,8 @@ JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledChassis_construct(JNI
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_CoupledChassis_free(JNIEnv *env, jclass claz,
                                                                         jlong handle) {
-  chassis *ch = jni_handle<chassis>(env, handle);
+  chassis *ch = jni_release_handle<chassis>(env, handle);
+  if (ch == nullptr) return;
   traits_t::destroy(_ch_alloc, ch);
   traits_t::deallocate(_ch_alloc, ch, 1);
 }
@@ -1,13 +1,52 @@
 #include "coupled/jnicoupled.h"
+#include "jniregistry.h"
 
 grpl::pf::coupled::state jni_coupled_java_to_state(JNIEnv *env, jdoubleArray arr) {
   double *                 els = env->GetDoubleArrayElements(arr, nullptr);
-  grpl::pf::coupled::state s{els[0],
-                             els[1],
-                             els[2],
-                             eigen_adapt_array<grpl::pf::coupled::configuration_state>(env, els + 3),
-                             eigen_adapt_array<grpl::pf::coupled::kinematic_state>(env, els + 6),
-                             els[9] > 0.5};
-  env->ReleaseDoubleArrayElements(arr, els, 0);
+  grpl::pf::coupled::state s   = jni_coupled_buffer_to_state(els);
+  env->ReleaseDoubleArrayElements(arr, els, JNI_ABORT);
   return s;
+}
+
+grpl::pf::coupled::state jni_coupled_buffer_to_state(const double *buf) {
+  return grpl::pf::coupled::state{buf[0],
+                                  buf[1],
+                                  buf[2],
+                                  grpl::pf::coupled::configuration_state{buf[3], buf[4], buf[5]},
+                                  grpl::pf::coupled::kinematic_state{buf[6], buf[7], buf[8]},
+                                  buf[9] > 0.5};
+}
+
+void jni_coupled_state_to_buffer(const grpl::pf::coupled::state &st, double *buf) {
+  buf[0] = st.time;
+  buf[1] = st.curvature;
+  buf[2] = st.dcurvature;
+  for (int i = 0; i < 3; i++) {
+    buf[3 + i] = st.config[i];
+    buf[6 + i] = st.kinematics[i];
+  }
+  buf[9] = st.finished ? 1.0 : 0.0;
+}
+
+void jni_coupled_wheel_state_to_buffer(const grpl::pf::coupled::wheel_state &ws, double *buf) {
+  buf[0] = ws.time;
+  buf[1] = ws.position[0];
+  buf[2] = ws.position[1];
+  for (int i = 0; i < 3; i++) {
+    buf[3 + i] = ws.kinematics[i];
+  }
+  buf[6] = ws.voltage;
+  buf[7] = ws.current;
+  buf[8] = ws.finished ? 1.0 : 0.0;
+}
+
+double *jni_coupled_direct_state(JNIEnv *env, jobject buffer) {
+  double *addr     = static_cast<double *>(env->GetDirectBufferAddress(buffer));
+  jlong   capacity = addr == nullptr ? 0 : env->GetDirectBufferCapacity(buffer);
+  if (capacity < static_cast<jlong>(jni_coupled_state_size * sizeof(double))) {
+    env->ThrowNew(jni_cache.illegal_argument_exception,
+                  "State buffer must be a direct buffer of at least 10 doubles");
+    return nullptr;
+  }
+  return addr;
 }
\ No newline at end of file
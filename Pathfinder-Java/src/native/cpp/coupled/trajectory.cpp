@@ -0,0 +1,99 @@
+#include "grpl_pathfinder_coupled_Trajectory.h"
+#include "jnihandle.h"
+#include "coupled/jnicoupled.h"
+
+#include <grpl/pf/coupled/causal_trajectory_generator.h>
+#include <grpl/pf/coupled/wheel_track.h>
+
+#include <algorithm>
+
+using namespace grpl::pf;
+
+void jni_trajectory_assign(jni_trajectory &traj, const coupled::chassis &chassis,
+                           const std::vector<coupled::state> &states) {
+  size_t n  = states.size();
+  traj.size = n;
+  traj.data.assign(n * jni_trajectory::column_count, 0);
+  traj.finished = n > 0 && states.back().finished;
+
+  for (size_t i = 0; i < n; i++) {
+    const coupled::state &st = states[i];
+
+    traj.col(jni_trajectory::time)[i]         = st.time;
+    traj.col(jni_trajectory::x)[i]            = st.config.x();
+    traj.col(jni_trajectory::y)[i]            = st.config.y();
+    traj.col(jni_trajectory::heading)[i]      = st.config[2];
+    traj.col(jni_trajectory::distance)[i]     = st.kinematics[POSITION];
+    traj.col(jni_trajectory::velocity)[i]     = st.kinematics[VELOCITY];
+    traj.col(jni_trajectory::acceleration)[i] = st.kinematics[ACCELERATION];
+    traj.col(jni_trajectory::curvature)[i]    = st.curvature;
+    traj.col(jni_trajectory::dcurvature)[i]   = st.dcurvature;
+  }
+
+  // Split the whole trajectory at once, see coupled::chassis::split(state_begin, state_end, left, right).
+  coupled::wheel_track left(n), right(n);
+  chassis.split(states.begin(), states.end(), left, right);
+
+  auto left_voltage  = left.voltage();
+  auto right_voltage = right.voltage();
+  std::copy(left_voltage.data(), left_voltage.data() + n, traj.col(jni_trajectory::left_voltage));
+  std::copy(right_voltage.data(), right_voltage.data() + n, traj.col(jni_trajectory::right_voltage));
+}
+
+void jni_trajectory_generate(const jni_trajectory_request &req, const util::task_executor::task *task,
+                             jni_trajectory &out) {
+  auto cancelled = [task]() { return task != nullptr && task->cancel_requested(); };
+
+  jni_curve_buffer_t curves;
+  jni_path_parameterize_quintic(req.param, req.waypoints, curves);
+  if (cancelled() || curves.empty()) return;
+
+  const coupled::causal_trajectory_generator gen{};
+  profile::profile::context                  ctx = req.profile_ctx;
+
+  std::vector<coupled::state> states;
+  coupled::state              st;
+  // The state at step i (from 1) is at time i * dt, matching CoupledCausalTrajGen.generateBatch.
+  for (size_t i = 1; !st.finished && i * req.dt <= req.timeout; i++) {
+    if ((i % 256) == 0 && cancelled()) return;
+
+    st = gen.generate(*req.chassis, curves.begin(), curves.end(), *req.prof, ctx, st, i * req.dt);
+    states.push_back(st);
+  }
+  if (cancelled()) return;
+
+  jni_trajectory_assign(out, *req.chassis, states);
+}
+
+JNIEXPORT jlong JNICALL Java_grpl_pathfinder_coupled_Trajectory_generate(
+    JNIEnv *env, jclass claz, jlong chassisHandle, jlong paramHandle, jlong profileHandle,
+    jdoubleArray waypoints, jdouble dt, jdouble timeout) {
+  coupled::chassis *       ch    = jni_handle<coupled::chassis>(env, chassisHandle);
+  path::arc_parameterizer *param = jni_handle<path::arc_parameterizer>(env, paramHandle);
+  profile::profile *       prof  = jni_handle<profile::profile>(env, profileHandle);
+  if (ch == nullptr || param == nullptr || prof == nullptr) return 0;
+
+  jni_trajectory_request req{jni_path_quintic_waypoints(env, waypoints), *param, ch, prof,
+                             prof->get_context(), dt, timeout};
+
+  jni_trajectory *traj = new jni_trajectory();
+  jni_trajectory_generate(req, nullptr, *traj);
+  return jni_as_handle<jni_trajectory>(traj);
+}
+
+JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_Trajectory_free(JNIEnv *env, jclass claz, jlong handle) {
+  delete jni_release_handle<jni_trajectory>(env, handle);
+}
+
+JNIEXPORT jboolean JNICALL Java_grpl_pathfinder_coupled_Trajectory_finished(JNIEnv *env, jclass claz,
+                                                                            jlong handle) {
+  jni_trajectory *traj = jni_handle<jni_trajectory>(env, handle);
+  return traj != nullptr && traj->finished;
+}
+
+JNIEXPORT jobject JNICALL Java_grpl_pathfinder_coupled_Trajectory_data(JNIEnv *env, jclass claz,
+                                                                       jlong handle) {
+  jni_trajectory *traj = jni_handle<jni_trajectory>(env, handle);
+  if (traj == nullptr || traj->data.empty()) return nullptr;
+  return env->NewDirectByteBuffer(traj->data.data(), static_cast<jlong>(traj->data.size() * sizeof(double)));
+}
@@ -0,0 +1,52 @@
+#include "grpl_pathfinder_coupled_TrajectoryFuture.h"
+#include "jnihandle.h"
+#include "coupled/jnicoupled.h"
+
+#include <chrono>
+#include <utility>
+
+using namespace grpl::pf;
+
+JNIEXPORT void JNICALL Java_grpl_pathfinder_coupled_TrajectoryFuture_free(JNIEnv *env, jclass claz,
+                                                                          jlong handle) {
+  jni_trajectory_future *future = jni_release_handle<jni_trajectory_future>(env, handle);
+  if (future == nullptr) return;
+
+  // The task refers to the chassis and profile, which Java may close as soon as the future is closed.
+  future->task->cancel();
+  future->task->wait();
+  delete future;
+}
+
+JNIEXPORT jint JNICALL Java_grpl_pathfinder_coupled_TrajectoryFuture_status(JNIEnv *env, jclass claz,
+                                                                            jlong handle) {
+  jni_trajectory_future *future = jni_handle<jni_trajectory_future>(env, handle);
+  return future == nullptr ? -1 : static_cast<jint>(future->task->get_status());
+}
+
+JNIEXPORT jboolean JNICALL Java_grpl_pathfinder_coupled_TrajectoryFuture_cancel(JNIEnv *env, jclass claz,
+                                                                                jlong handle) {
+  jni_trajectory_future *future = jni_handle<jni_trajectory_future>(env, handle);
+  return future != nullptr && future->task->cancel();
+}
+
+JNIEXPORT jboolean JNICALL Java_grpl_pathfinder_coupled_TrajectoryFuture_await(JNIEnv *env, jclass claz,
+                                                                               jlong handle,
+                                                                               jlong timeoutNanos) {
+  jni_trajectory_future *future = jni_handle<jni_trajectory_future>(env, handle);
+  if (future == nullptr) return false;
+  if (timeoutNanos < 0) {
+    future->task->wait();
+    return true;
+  }
+  return future->task->wait_for(std::chrono::nanoseconds(timeoutNanos));
+}
+
+JNIEXPORT jlong JNICALL Java_grpl_pathfinder_coupled_TrajectoryFuture_take(JNIEnv *env, jclass claz,
+                                                                           jlong handle) {
+  jni_trajectory_future *future = jni_handle<jni_trajectory_future>(env, handle);
+  if (future == nullptr || future->task->get_status() != util::task_executor::status::completed) return 0;
+
+  // The columns are moved, not copied, into the trajectory handed to Java.
+  return jni_as_handle<jni_trajectory>(new jni_trajectory(std::move(*future->result)));
+}
@@ -1,6 +1,48 @@
 #include "jnihandle.h"
-#include "jniutil.h"
+#include "jniregistry.h"
+
+#include <new>
+
+jni_handle_table jni_handles;
 
 jfieldID jni_get_handle_field(JNIEnv *env, jobject obj) {
-  return jni_get_field_id(env, obj, "_handle", "J");
-}
\ No newline at end of file
+  return jni_cache.native_resource_handle;
+}
+
+void jni_throw_closed(JNIEnv *env) {
+  env->ThrowNew(jni_cache.closed_exception, "This object is closed!");
+}
+
+jlong jni_handle_table::insert(void *ptr) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  uint32_t i;
+  if (!_free.empty()) {
+    i = _free.back();
+    _free.pop_back();
+  } else {
+    if (_size == max_chunks * chunk_size) throw std::bad_alloc();
+    i = _size++;
+    if (i % chunk_size == 0) _chunks[i / chunk_size].store(new slot[chunk_size], std::memory_order_release);
+  }
+
+  slot &s = _chunks[i / chunk_size].load(std::memory_order_relaxed)[i % chunk_size];
+  s.ptr.store(ptr, std::memory_order_release);
+  return static_cast<jlong>(static_cast<uint64_t>(s.generation.load(std::memory_order_relaxed)) << 32 |
+                            (static_cast<uint64_t>(i) + 1));
+}
+
+void *jni_handle_table::remove(jlong handle) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  void *ptr = get(handle);
+  if (ptr == nullptr) return nullptr;
+
+  uint32_t i = static_cast<uint32_t>((static_cast<uint64_t>(handle) & 0xFFFFFFFFu) - 1);
+  slot &   s = _chunks[i / chunk_size].load(std::memory_order_relaxed)[i % chunk_size];
+
+  s.generation.store(s.generation.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  s.ptr.store(nullptr, std::memory_order_release);
+  _free.push_back(i);
+  return ptr;
+}
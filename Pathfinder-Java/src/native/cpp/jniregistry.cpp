@@ -0,0 +1,263 @@
+#include "jniregistry.h"
+
+#include "grpl_pathfinder_coupled_CoupledAsyncTrajGen.h"
+#include "grpl_pathfinder_coupled_CoupledCausalTrajGen.h"
+#include "grpl_pathfinder_coupled_CoupledChassis.h"
+#include "grpl_pathfinder_coupled_Trajectory.h"
+#include "grpl_pathfinder_coupled_TrajectoryFuture.h"
+#include "grpl_pathfinder_path_AbstractCurve2d.h"
+#include "grpl_pathfinder_path_AbstractSpline2d.h"
+#include "grpl_pathfinder_path_Arc2d.h"
+#include "grpl_pathfinder_path_ArcParameterizer.h"
+#include "grpl_pathfinder_path_CurveBuffer.h"
+#include "grpl_pathfinder_path_HermiteCubic.h"
+#include "grpl_pathfinder_path_HermiteQuintic.h"
+#include "grpl_pathfinder_profile_AbstractNativeProfile.h"
+#include "grpl_pathfinder_profile_TrapezoidalProfile.h"
+#include "grpl_pathfinder_transmission_AbstractDcTransmission.h"
+#include "grpl_pathfinder_transmission_DcMotor.h"
+#include "grpl_pathfinder_transmission_JavaDcTransmissionAdapter.h"
+
+#include <iterator>
+
+jni_registry jni_cache;
+
+// Natives are bound with RegisterNatives when the library is loaded, rather than resolved by symbol name
+// on the first call of each. A mismatch between these tables and the Java declarations fails the load,
+// instead of the first call of the mismatched native.
+#define JNI_NATIVE(cls, name, sig)                                                        \
+  {                                                                                       \
+    const_cast<char *>(#name), const_cast<char *>(sig),                                   \
+        reinterpret_cast<void *>(&Java_grpl_pathfinder_##cls##_##name)                    \
+  }
+
+static const JNINativeMethod coupled_async_traj_gen_natives[] = {
+    JNI_NATIVE(coupled_CoupledAsyncTrajGen, allocate, "(I)J"),
+    JNI_NATIVE(coupled_CoupledAsyncTrajGen, free, "(J)V"),
+    JNI_NATIVE(coupled_CoupledAsyncTrajGen, submit, "(JJJJ[DDDZ)J"),
+};
+
+static const JNINativeMethod coupled_causal_traj_gen_natives[] = {
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, allocate, "()J"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, free, "(J)V"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, generateNative, "(JJJJ[DD)[D"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, generateBatchNative, "(JJJJ[DDI[D[D)I"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, generateDirect,
+               "(JJJJLjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;D)V"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, acquireBuffer, "()J"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, enqueueNative, "(JJ)V"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, enqueueAdapter, "(JLgrpl/pathfinder/path/Curve2d;)V"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, enqueueCurveBuffer, "(JJ)V"),
+    JNI_NATIVE(coupled_CoupledCausalTrajGen, releaseBuffer, "(J)V"),
+};
+
+static const JNINativeMethod coupled_chassis_natives[] = {
+    JNI_NATIVE(coupled_CoupledChassis, allocateStub, "()J"),
+    JNI_NATIVE(coupled_CoupledChassis, construct, "(JJJDDD)V"),
+    JNI_NATIVE(coupled_CoupledChassis, free, "(J)V"),
+    JNI_NATIVE(coupled_CoupledChassis, linvelLimit, "(J[DD)D"),
+    JNI_NATIVE(coupled_CoupledChassis, accLimit, "(J[DDD)[D"),
+    JNI_NATIVE(coupled_CoupledChassis, splitNative, "(J[D[D[D)V"),
+};
+
+static const JNINativeMethod trajectory_natives[] = {
+    JNI_NATIVE(coupled_Trajectory, generate, "(JJJ[DDD)J"),
+    JNI_NATIVE(coupled_Trajectory, free, "(J)V"),
+    JNI_NATIVE(coupled_Trajectory, finished, "(J)Z"),
+    JNI_NATIVE(coupled_Trajectory, data, "(J)Ljava/nio/ByteBuffer;"),
+};
+
+static const JNINativeMethod trajectory_future_natives[] = {
+    JNI_NATIVE(coupled_TrajectoryFuture, free, "(J)V"),
+    JNI_NATIVE(coupled_TrajectoryFuture, status, "(J)I"),
+    JNI_NATIVE(coupled_TrajectoryFuture, cancel, "(J)Z"),
+    JNI_NATIVE(coupled_TrajectoryFuture, await, "(JJ)Z"),
+    JNI_NATIVE(coupled_TrajectoryFuture, take, "(J)J"),
+};
+
+static const JNINativeMethod abstract_curve2d_natives[] = {
+    JNI_NATIVE(path_AbstractCurve2d, position, "(JD)[D"),
+    JNI_NATIVE(path_AbstractCurve2d, derivative, "(JD)[D"),
+    JNI_NATIVE(path_AbstractCurve2d, rotation, "(JD)[D"),
+    JNI_NATIVE(path_AbstractCurve2d, curvature, "(JD)D"),
+    JNI_NATIVE(path_AbstractCurve2d, dcurvature, "(JD)D"),
+    JNI_NATIVE(path_AbstractCurve2d, length, "(J)D"),
+    JNI_NATIVE(path_AbstractCurve2d, free, "(J)V"),
+};
+
+static const JNINativeMethod abstract_spline2d_natives[] = {
+    JNI_NATIVE(path_AbstractSpline2d, position, "(JD)[D"),
+    JNI_NATIVE(path_AbstractSpline2d, derivative, "(JD)[D"),
+    JNI_NATIVE(path_AbstractSpline2d, rotation, "(JD)[D"),
+    JNI_NATIVE(path_AbstractSpline2d, curvature, "(JD)D"),
+    JNI_NATIVE(path_AbstractSpline2d, free, "(J)V"),
+};
+
+static const JNINativeMethod arc2d_natives[] = {
+    JNI_NATIVE(path_Arc2d, allocate, "([D[D[D)J"),
+};
+
+static const JNINativeMethod arc_parameterizer_natives[] = {
+    JNI_NATIVE(path_ArcParameterizer, allocate, "()J"),
+    JNI_NATIVE(path_ArcParameterizer, free, "(J)V"),
+    JNI_NATIVE(path_ArcParameterizer, configure, "(JDD)V"),
+    JNI_NATIVE(path_ArcParameterizer, parameterize, "(JJ)[J"),
+    JNI_NATIVE(path_ArcParameterizer, parameterizeToBuffer, "(JJ)J"),
+    JNI_NATIVE(path_ArcParameterizer, parameterizeWaypoints, "(J[D)J"),
+    JNI_NATIVE(path_ArcParameterizer, acquireBuffer, "()J"),
+    JNI_NATIVE(path_ArcParameterizer, enqueueNative, "(JJ)V"),
+    JNI_NATIVE(path_ArcParameterizer, enqueueAdapter, "(JLgrpl/pathfinder/path/Spline2d;)V"),
+    JNI_NATIVE(path_ArcParameterizer, releaseBuffer, "(J)V"),
+};
+
+static const JNINativeMethod curve_buffer_natives[] = {
+    JNI_NATIVE(path_CurveBuffer, free, "(J)V"),
+    JNI_NATIVE(path_CurveBuffer, size, "(J)I"),
+    JNI_NATIVE(path_CurveBuffer, lengths, "(J[D)V"),
+    JNI_NATIVE(path_CurveBuffer, sample, "(J[D[D)V"),
+};
+
+static const JNINativeMethod hermite_cubic_natives[] = {
+    JNI_NATIVE(path_HermiteCubic, allocate, "([D[D)J"),
+};
+
+static const JNINativeMethod hermite_quintic_natives[] = {
+    JNI_NATIVE(path_HermiteQuintic, allocate, "([D[D)J"),
+};
+
+static const JNINativeMethod abstract_native_profile_natives[] = {
+    JNI_NATIVE(profile_AbstractNativeProfile, calculateNative, "(J[DDD)[D"),
+    JNI_NATIVE(profile_AbstractNativeProfile, setGoal, "(JD)V"),
+    JNI_NATIVE(profile_AbstractNativeProfile, getGoal, "(J)D"),
+    JNI_NATIVE(profile_AbstractNativeProfile, setTimeslice, "(JD)V"),
+    JNI_NATIVE(profile_AbstractNativeProfile, getTimeslice, "(J)D"),
+    JNI_NATIVE(profile_AbstractNativeProfile, applyLimit, "(JIDD)V"),
+    JNI_NATIVE(profile_AbstractNativeProfile, free, "(J)V"),
+};
+
+static const JNINativeMethod trapezoidal_profile_natives[] = {
+    JNI_NATIVE(profile_TrapezoidalProfile, allocate, "()J"),
+};
+
+static const JNINativeMethod abstract_dc_transmission_natives[] = {
+    JNI_NATIVE(transmission_AbstractDcTransmission, freeSpeed, "(JD)D"),
+    JNI_NATIVE(transmission_AbstractDcTransmission, current, "(JDD)D"),
+    JNI_NATIVE(transmission_AbstractDcTransmission, torque, "(JD)D"),
+    JNI_NATIVE(transmission_AbstractDcTransmission, freeVoltage, "(JD)D"),
+    JNI_NATIVE(transmission_AbstractDcTransmission, currentVoltage, "(JD)D"),
+    JNI_NATIVE(transmission_AbstractDcTransmission, torqueCurrent, "(JD)D"),
+    JNI_NATIVE(transmission_AbstractDcTransmission, nominalVoltage, "(J)D"),
+    JNI_NATIVE(transmission_AbstractDcTransmission, free, "(J)V"),
+};
+
+static const JNINativeMethod dc_motor_natives[] = {
+    JNI_NATIVE(transmission_DcMotor, allocate, "(DDDDD)J"),
+};
+
+static const JNINativeMethod java_dc_transmission_adapter_natives[] = {
+    JNI_NATIVE(transmission_JavaDcTransmissionAdapter, allocate,
+               "(Lgrpl/pathfinder/transmission/DcTransmission;)J"),
+    JNI_NATIVE(transmission_JavaDcTransmissionAdapter, allocateSnapshot,
+               "(Lgrpl/pathfinder/transmission/DcTransmission;I)J"),
+};
+
+struct jni_native_class {
+  const char *           name;
+  const JNINativeMethod *methods;
+  jint                   count;
+};
+
+#define JNI_CLASS(name, natives) \
+  { name, natives, static_cast<jint>(std::end(natives) - std::begin(natives)) }
+
+static const jni_native_class native_classes[] = {
+    JNI_CLASS("grpl/pathfinder/coupled/CoupledAsyncTrajGen", coupled_async_traj_gen_natives),
+    JNI_CLASS("grpl/pathfinder/coupled/CoupledCausalTrajGen", coupled_causal_traj_gen_natives),
+    JNI_CLASS("grpl/pathfinder/coupled/CoupledChassis", coupled_chassis_natives),
+    JNI_CLASS("grpl/pathfinder/coupled/Trajectory", trajectory_natives),
+    JNI_CLASS("grpl/pathfinder/coupled/TrajectoryFuture", trajectory_future_natives),
+    JNI_CLASS("grpl/pathfinder/path/AbstractCurve2d", abstract_curve2d_natives),
+    JNI_CLASS("grpl/pathfinder/path/AbstractSpline2d", abstract_spline2d_natives),
+    JNI_CLASS("grpl/pathfinder/path/Arc2d", arc2d_natives),
+    JNI_CLASS("grpl/pathfinder/path/ArcParameterizer", arc_parameterizer_natives),
+    JNI_CLASS("grpl/pathfinder/path/CurveBuffer", curve_buffer_natives),
+    JNI_CLASS("grpl/pathfinder/path/HermiteCubic", hermite_cubic_natives),
+    JNI_CLASS("grpl/pathfinder/path/HermiteQuintic", hermite_quintic_natives),
+    JNI_CLASS("grpl/pathfinder/profile/AbstractNativeProfile", abstract_native_profile_natives),
+    JNI_CLASS("grpl/pathfinder/profile/TrapezoidalProfile", trapezoidal_profile_natives),
+    JNI_CLASS("grpl/pathfinder/transmission/AbstractDcTransmission", abstract_dc_transmission_natives),
+    JNI_CLASS("grpl/pathfinder/transmission/DcMotor", dc_motor_natives),
+    JNI_CLASS("grpl/pathfinder/transmission/JavaDcTransmissionAdapter", java_dc_transmission_adapter_natives),
+};
+
+// A global reference to a class, or nullptr (with an exception pending) if it does not exist.
+static jclass find_class(JNIEnv *env, const char *name) {
+  jclass local = env->FindClass(name);
+  if (local == nullptr) return nullptr;
+  jclass global = static_cast<jclass>(env->NewGlobalRef(local));
+  env->DeleteLocalRef(local);
+  return global;
+}
+
+static bool load_registry(JNIEnv *env, jni_registry &reg) {
+  reg.closed_exception           = find_class(env, "grpl/pathfinder/util/ClosedException");
+  reg.illegal_argument_exception = find_class(env, "java/lang/IllegalArgumentException");
+  if (reg.closed_exception == nullptr || reg.illegal_argument_exception == nullptr) return false;
+
+  jclass resource            = env->FindClass("grpl/pathfinder/util/NativeResource");
+  reg.native_resource_handle = env->GetFieldID(resource, "_handle", "J");
+  env->DeleteLocalRef(resource);
+
+  reg.profile_state.cls = find_class(env, "grpl/pathfinder/profile/Profile$State");
+  if (reg.profile_state.cls == nullptr) return false;
+  reg.profile_state.init       = env->GetMethodID(reg.profile_state.cls, "<init>", "(I)V");
+  reg.profile_state.time       = env->GetFieldID(reg.profile_state.cls, "time", "D");
+  reg.profile_state.kinematics = env->GetFieldID(reg.profile_state.cls, "kinematics", "[D");
+
+  jclass transmission                 = env->FindClass("grpl/pathfinder/transmission/DcTransmission");
+  reg.dc_transmission.free_speed      = env->GetMethodID(transmission, "getFreeSpeed", "(D)D");
+  reg.dc_transmission.current         = env->GetMethodID(transmission, "getCurrent", "(DD)D");
+  reg.dc_transmission.torque          = env->GetMethodID(transmission, "getTorque", "(D)D");
+  reg.dc_transmission.free_voltage    = env->GetMethodID(transmission, "getFreeVoltage", "(D)D");
+  reg.dc_transmission.current_voltage = env->GetMethodID(transmission, "getCurrentVoltage", "(D)D");
+  reg.dc_transmission.torque_current  = env->GetMethodID(transmission, "getTorqueCurrent", "(D)D");
+  reg.dc_transmission.nominal_voltage = env->GetMethodID(transmission, "getNominalVoltage", "()D");
+  env->DeleteLocalRef(transmission);
+
+  jclass spline       = env->FindClass("grpl/pathfinder/path/Spline2d");
+  reg.spline2d.sample = env->GetMethodID(spline, "sample", "([D[D)V");
+  env->DeleteLocalRef(spline);
+
+  // Any missing class, field or method leaves an exception pending.
+  return !env->ExceptionCheck();
+}
+
+static bool register_natives(JNIEnv *env) {
+  for (const jni_native_class &nc : native_classes) {
+    jclass cls = env->FindClass(nc.name);
+    if (cls == nullptr) return false;
+    jint result = env->RegisterNatives(cls, nc.methods, nc.count);
+    env->DeleteLocalRef(cls);
+    if (result != JNI_OK) return false;
+  }
+  return true;
+}
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *vm, void *reserved) {
+  JNIEnv *env = nullptr;
+  if (vm->GetEnv(reinterpret_cast<void **>(&env), JNI_VERSION_1_6) != JNI_OK) return JNI_ERR;
+
+  jni_cache.vm = vm;
+  if (!load_registry(env, jni_cache) || !register_natives(env)) return JNI_ERR;
+  return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL JNI_OnUnload(JavaVM *vm, void *reserved) {
+  JNIEnv *env = nullptr;
+  if (vm->GetEnv(reinterpret_cast<void **>(&env), JNI_VERSION_1_6) != JNI_OK) return;
+
+  env->DeleteGlobalRef(jni_cache.closed_exception);
+  env->DeleteGlobalRef(jni_cache.illegal_argument_exception);
+  env->DeleteGlobalRef(jni_cache.profile_state.cls);
+  jni_cache = jni_registry{};
+}
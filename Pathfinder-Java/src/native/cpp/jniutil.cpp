@@ -30,4 +30,11 @@ jobject jni_construct(JNIEnv *env, const char *cls_name, const char *sig, ...) {
   va_end(args);
   // jobject result = env->NewObject(clazz, constructor);
   return result;
+}
+
+JNIEnv *jni_current_env(JavaVM *vm) {
+  JNIEnv *env = nullptr;
+  if (vm->GetEnv(reinterpret_cast<void **>(&env), JNI_VERSION_1_6) == JNI_EDETACHED)
+    vm->AttachCurrentThreadAsDaemon(reinterpret_cast<void **>(&env), nullptr);
+  return env;
 }
\ No newline at end of file
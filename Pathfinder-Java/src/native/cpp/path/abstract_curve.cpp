@@ -44,5 +44,5 @@ JNIEXPORT jdouble JNICALL Java_grpl_pathfinder_path_AbstractCurve2d_length(JNIEn
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_path_AbstractCurve2d_free(JNIEnv *env, jclass claz,
                                                                       jlong handle) {
-  delete jni_handle<curve_t>(env, handle);
+  delete jni_release_handle<curve_t>(env, handle);
 }
\ No newline at end of file
@@ -33,5 +33,5 @@ JNIEXPORT jdouble JNICALL Java_grpl_pathfinder_path_AbstractSpline2d_curvature(J
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_path_AbstractSpline2d_free(JNIEnv *env, jclass claz,
                                                                        jlong handle) {
-  delete jni_handle<spline_t>(env, handle);
+  delete jni_release_handle<spline_t>(env, handle);
 }
\ No newline at end of file
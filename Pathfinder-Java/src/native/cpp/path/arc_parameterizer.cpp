@@ -1,57 +1,103 @@
 #include "grpl_pathfinder_path_ArcParameterizer.h"
 #include "jnieigen.h"
 #include "jnihandle.h"
+#include "jniregistry.h"
 #include "jniutil.h"
+#include "path/jnipath.h"
 
+#include <algorithm>
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include <grpl/pf/path/arc_parameterizer.h>
 
 using namespace grpl::pf::path;
 
-using spline_container_t = std::vector<std::reference_wrapper<spline<2>>>;
-using curve_container_t  = std::vector<arc_parameterizer::curve_t>;
-
-class java_spline_wrapper : public spline<2> {
+using curve_container_t = std::vector<arc_parameterizer::curve_t>;
+
+// Number of samples taken of a Java spline, see java_sampled_spline.
+constexpr int jni_spline_samples = 1025;
+// Number of doubles in each sample of a Java spline. See Spline2d.sample(double[], double[]).
+constexpr int jni_spline_sample_size = 5;
+
+/**
+ * Adapter for a spline implemented in Java, from a table of samples.
+ *
+ * Calling back into Java for every evaluation (allocating a Vec2 and an array for each) dominates the time
+ * spent parameterizing, so the spline is instead sampled at uniform t in a single batched call to
+ * Spline2d.sample(double[], double[]). Position is interpolated between samples by a cubic hermite of the
+ * sampled positions and derivatives, and curvature linearly. The Java spline is not referenced after
+ * construction.
+ */
+class java_sampled_spline : public spline<2> {
  public:
   using vector_t = typename spline::vector_t;
 
-  java_spline_wrapper(JNIEnv *env, jobject obj) : _env(env) {
-    _obj    = env->NewGlobalRef(obj);
-    _posid  = jni_get_method_id(env, obj, "position", "(D)Lgrpl/pathfinder/path/Vec2;");
-    _velid  = jni_get_method_id(env, obj, "derivative", "(D)Lgrpl/pathfinder/path/Vec2;");
-    _rotid  = jni_get_method_id(env, obj, "rotation", "(D)Lgrpl/pathfinder/path/Vec2;");
-    _curvid = jni_get_method_id(env, obj, "curvature", "(D)D");
-    _vecxy  = jni_get_method_id(env, "grpl/pathfinder/path/Vec2", "xy", "()[D");
-  }
+  java_sampled_spline(JNIEnv *env, jobject obj, int samples)
+      : _count(samples), _table(samples * jni_spline_sample_size) {
+    std::vector<double> t(samples);
+    for (int i = 0; i < samples; i++) t[i] = static_cast<double>(i) / (samples - 1);
+
+    jdoubleArray tArr   = env->NewDoubleArray(samples);
+    jdoubleArray outArr = env->NewDoubleArray(samples * jni_spline_sample_size);
+    env->SetDoubleArrayRegion(tArr, 0, samples, t.data());
 
-  virtual ~java_spline_wrapper() { _env->DeleteGlobalRef(_obj); }
+    env->CallVoidMethod(obj, jni_cache.spline2d.sample, tArr, outArr);
+    env->GetDoubleArrayRegion(outArr, 0, samples * jni_spline_sample_size, _table.data());
 
-  vector_t position(double s) override {
-    jobject      vec2 = _env->CallObjectMethod(_obj, _posid, s);
-    jdoubleArray arr  = reinterpret_cast<jdoubleArray>(_env->CallObjectMethod(vec2, _vecxy));
-    return eigen_adapt_jdoubleArray<vector_t>(_env, arr);
+    env->DeleteLocalRef(tArr);
+    env->DeleteLocalRef(outArr);
   }
 
-  vector_t derivative(double s) override {
-    jobject      vec2 = _env->CallObjectMethod(_obj, _velid, s);
-    jdoubleArray arr  = reinterpret_cast<jdoubleArray>(_env->CallObjectMethod(vec2, _vecxy));
-    return eigen_adapt_jdoubleArray<vector_t>(_env, arr);
+  vector_t position(double t) override {
+    double u, h;
+    int    i = segment(t, u, h);
+
+    double h00 = 2 * u * u * u - 3 * u * u + 1, h10 = u * u * u - 2 * u * u + u;
+    double h01 = -2 * u * u * u + 3 * u * u, h11 = u * u * u - u * u;
+    return h00 * sample_position(i) + h10 * h * sample_derivative(i) + h01 * sample_position(i + 1) +
+           h11 * h * sample_derivative(i + 1);
   }
 
-  vector_t rotation(double s) override {
-    jobject      vec2 = _env->CallObjectMethod(_obj, _rotid, s);
-    jdoubleArray arr  = reinterpret_cast<jdoubleArray>(_env->CallObjectMethod(vec2, _vecxy));
-    return eigen_adapt_jdoubleArray<vector_t>(_env, arr);
+  vector_t derivative(double t) override {
+    double u, h;
+    int    i = segment(t, u, h);
+
+    double d00 = 6 * u * u - 6 * u, d10 = 3 * u * u - 4 * u + 1;
+    double d01 = -6 * u * u + 6 * u, d11 = 3 * u * u - 2 * u;
+    return (d00 * sample_position(i) + d01 * sample_position(i + 1)) / h + d10 * sample_derivative(i) +
+           d11 * sample_derivative(i + 1);
   }
 
-  double curvature(double s) override { return _env->CallDoubleMethod(_obj, _curvid, s); }
+  double curvature(double t) override {
+    double u, h;
+    int    i = segment(t, u, h);
+    return (1 - u) * sample(i)[4] + u * sample(i + 1)[4];
+  }
 
  private:
-  JNIEnv *  _env;
-  jobject   _obj;
-  jmethodID _posid, _velid, _rotid, _curvid, _vecxy;
+  // The index of the sample starting the segment containing t, and the position within the segment.
+  int segment(double t, double &u, double &h) const {
+    h         = 1.0 / (_count - 1);
+    double ti = std::max(0.0, std::min(1.0, t)) / h;
+    int    i  = std::min(static_cast<int>(ti), _count - 2);
+    u         = ti - i;
+    return i;
+  }
+
+  const double *sample(int i) const { return _table.data() + i * jni_spline_sample_size; }
+  vector_t      sample_position(int i) const { return vector_t{sample(i)[0], sample(i)[1]}; }
+  vector_t      sample_derivative(int i) const { return vector_t{sample(i)[2], sample(i)[3]}; }
+
+  int                 _count;
+  std::vector<double> _table;
+};
+
+// The splines to be parameterized, and ownership of the adapters of any Java splines among them.
+struct spline_buffer_t {
+  std::vector<std::reference_wrapper<spline<2>>> splines;
+  std::vector<std::unique_ptr<spline<2>>>        adapters;
 };
 
 JNIEXPORT jlong JNICALL Java_grpl_pathfinder_path_ArcParameterizer_allocate(JNIEnv *env, jclass claz) {
@@ -60,7 +106,7 @@ JNIEXPORT jlong JNICALL Java_grpl_pathfinder_path_ArcParameterizer_allocate(JNIE
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_path_ArcParameterizer_free(JNIEnv *env, jclass claz,
                                                                        jlong handle) {
-  delete jni_handle<arc_parameterizer>(env, handle);
+  delete jni_release_handle<arc_parameterizer>(env, handle);
 }
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_path_ArcParameterizer_configure(JNIEnv *env, jclass claz,
@@ -73,36 +119,64 @@ JNIEXPORT void JNICALL Java_grpl_pathfinder_path_ArcParameterizer_configure(JNIE
 JNIEXPORT jlongArray JNICALL Java_grpl_pathfinder_path_ArcParameterizer_parameterize(JNIEnv *env, jclass claz,
                                                                                      jlong handle,
                                                                                      jlong bufferHandle) {
-  spline_container_t *splines = jni_handle<spline_container_t>(env, bufferHandle);
-  curve_container_t   curves;
+  spline_buffer_t * buffer = jni_handle<spline_buffer_t>(env, bufferHandle);
+  curve_container_t curves;
   jni_handle<arc_parameterizer>(env, handle)
-      ->parameterize(splines->begin(), splines->end(), std::back_inserter(curves), curves.max_size());
+      ->parameterize(buffer->splines.begin(), buffer->splines.end(), std::back_inserter(curves),
+                     curves.max_size());
 
   return jni_copy_to_handles<arc_parameterizer::curve_t>(env, curves);
 }
 
+JNIEXPORT jlong JNICALL Java_grpl_pathfinder_path_ArcParameterizer_parameterizeToBuffer(JNIEnv *env,
+                                                                                        jclass claz,
+                                                                                        jlong  handle,
+                                                                                        jlong  bufferHandle) {
+  spline_buffer_t *   buffer = jni_handle<spline_buffer_t>(env, bufferHandle);
+  jni_curve_buffer_t *curves = new jni_curve_buffer_t();
+  jni_handle<arc_parameterizer>(env, handle)
+      ->parameterize(buffer->splines.begin(), buffer->splines.end(), std::back_inserter(*curves),
+                     curves->max_size());
+
+  curves->shrink_to_fit();
+  return jni_as_handle<jni_curve_buffer_t>(curves);
+}
+
+JNIEXPORT jlong JNICALL Java_grpl_pathfinder_path_ArcParameterizer_parameterizeWaypoints(
+    JNIEnv *env, jclass claz, jlong handle, jdoubleArray waypoints) {
+  arc_parameterizer *param = jni_handle<arc_parameterizer>(env, handle);
+  if (param == nullptr) return 0;
+
+  jni_curve_buffer_t *curves = new jni_curve_buffer_t();
+  jni_path_parameterize_quintic(*param, jni_path_quintic_waypoints(env, waypoints), *curves);
+
+  curves->shrink_to_fit();
+  return jni_as_handle<jni_curve_buffer_t>(curves);
+}
+
 JNIEXPORT jlong JNICALL Java_grpl_pathfinder_path_ArcParameterizer_acquireBuffer(JNIEnv *env, jclass claz) {
-  return jni_as_handle<spline_container_t>(new spline_container_t());
+  return jni_as_handle<spline_buffer_t>(new spline_buffer_t());
 }
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_path_ArcParameterizer_enqueueNative(JNIEnv *env, jclass claz,
                                                                                 jlong bufferHandle,
                                                                                 jlong splineHandle) {
-  spline_container_t *splines = jni_handle<spline_container_t>(env, bufferHandle);
+  spline_buffer_t *buffer = jni_handle<spline_buffer_t>(env, bufferHandle);
 
   spline<2> *spl = jni_handle<spline<2>>(env, splineHandle);
-  splines->push_back(*spl);
+  buffer->splines.push_back(*spl);
 }
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_path_ArcParameterizer_enqueueAdapter(JNIEnv *env, jclass claz,
                                                                                  jlong   bufferHandle,
                                                                                  jobject javaSpline) {
-  spline_container_t *splines = jni_handle<spline_container_t>(env, bufferHandle);
-  spline<2> *         spl     = new java_spline_wrapper(env, javaSpline);
-  splines->push_back(*spl);
+  spline_buffer_t *buffer = jni_handle<spline_buffer_t>(env, bufferHandle);
+
+  buffer->adapters.emplace_back(new java_sampled_spline(env, javaSpline, jni_spline_samples));
+  buffer->splines.push_back(*buffer->adapters.back());
 }
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_path_ArcParameterizer_releaseBuffer(JNIEnv *env, jclass claz,
                                                                                 jlong bufferHandle) {
-  delete jni_handle<spline_container_t>(env, bufferHandle);
+  delete jni_release_handle<spline_buffer_t>(env, bufferHandle);
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "grpl_pathfinder_path_CurveBuffer.h"
+#include "jnihandle.h"
+#include "path/jnipath.h"
+
+#include <cmath>
+
+using namespace grpl::pf::path;
+
+JNIEXPORT void JNICALL Java_grpl_pathfinder_path_CurveBuffer_free(JNIEnv *env, jclass claz, jlong handle) {
+  delete jni_release_handle<jni_curve_buffer_t>(env, handle);
+}
+
+JNIEXPORT jint JNICALL Java_grpl_pathfinder_path_CurveBuffer_size(JNIEnv *env, jclass claz, jlong handle) {
+  return static_cast<jint>(jni_handle<jni_curve_buffer_t>(env, handle)->size());
+}
+
+JNIEXPORT void JNICALL Java_grpl_pathfinder_path_CurveBuffer_lengths(JNIEnv *env, jclass claz, jlong handle,
+                                                                      jdoubleArray out) {
+  jni_curve_buffer_t *curves = jni_handle<jni_curve_buffer_t>(env, handle);
+
+  std::vector<double> lengths;
+  lengths.reserve(curves->size());
+  for (auto &c : *curves) lengths.push_back(c.length());
+  env->SetDoubleArrayRegion(out, 0, static_cast<jsize>(lengths.size()), lengths.data());
+}
+
+JNIEXPORT void JNICALL Java_grpl_pathfinder_path_CurveBuffer_sample(JNIEnv *env, jclass claz, jlong handle,
+                                                                     jdoubleArray distanceArr,
+                                                                     jdoubleArray out) {
+  jni_curve_buffer_t *curves = jni_handle<jni_curve_buffer_t>(env, handle);
+
+  jsize               count = env->GetArrayLength(distanceArr);
+  std::vector<double> distances(count), samples(4 * count);
+  env->GetDoubleArrayRegion(distanceArr, 0, count, distances.data());
+
+  // Distances are expected to be mostly increasing, so the search for the curve containing each distance
+  // starts from the curve of the last distance.
+  size_t idx   = 0;
+  double start = 0;
+  for (jsize i = 0; i < count && !curves->empty(); i++) {
+    double distance = distances[i];
+    if (distance < start) {
+      idx   = 0;
+      start = 0;
+    }
+    while (idx + 1 < curves->size() && start + (*curves)[idx].length() < distance) {
+      start += (*curves)[idx].length();
+      idx++;
+    }
+
+    arc_parameterizer::curve_t &c = (*curves)[idx];
+    double                      s = distance - start;
+
+    arc_parameterizer::vector_t pos = c.position(s), rot = c.rotation(s);
+
+    samples[4 * i]     = pos.x();
+    samples[4 * i + 1] = pos.y();
+    samples[4 * i + 2] = atan2(rot.y(), rot.x());
+    samples[4 * i + 3] = c.curvature(s);
+  }
+
+  env->SetDoubleArrayRegion(out, 0, 4 * count, samples.data());
+}
\ No newline at end of file
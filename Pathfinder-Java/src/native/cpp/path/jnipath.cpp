@@ -0,0 +1,34 @@
+#include "path/jnipath.h"
+
+#include <iterator>
+
+std::vector<grpl::pf::path::hermite_quintic::waypoint> jni_path_quintic_waypoints(JNIEnv *     env,
+                                                                                  jdoubleArray arr) {
+  using waypoint_t = grpl::pf::path::hermite_quintic::waypoint;
+
+  jsize                   count = env->GetArrayLength(arr) / jni_quintic_waypoint_size;
+  std::vector<double>     flat(count * jni_quintic_waypoint_size);
+  std::vector<waypoint_t> wps;
+  env->GetDoubleArrayRegion(arr, 0, static_cast<jsize>(flat.size()), flat.data());
+
+  wps.reserve(count);
+  for (jsize i = 0; i < count; i++) {
+    const double *wp = &flat[i * jni_quintic_waypoint_size];
+    wps.push_back(waypoint_t{{wp[0], wp[1]}, {wp[2], wp[3]}, {wp[4], wp[5]}});
+  }
+  return wps;
+}
+
+void jni_path_parameterize_quintic(const grpl::pf::path::arc_parameterizer &                   param,
+                                   const std::vector<grpl::pf::path::hermite_quintic::waypoint> &waypoints,
+                                   jni_curve_buffer_t &                                          curves) {
+  using namespace grpl::pf::path;
+
+  std::vector<hermite_quintic> hermites;
+  hermites.reserve(waypoints.size());
+  hermite_factory::generate<hermite_quintic>(waypoints.begin(), waypoints.end(), std::back_inserter(hermites),
+                                             hermites.max_size());
+
+  arc_parameterizer::context ctx;
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size(), ctx);
+}
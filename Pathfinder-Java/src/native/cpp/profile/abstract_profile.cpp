@@ -42,5 +42,5 @@ JNIEXPORT void JNICALL Java_grpl_pathfinder_profile_AbstractNativeProfile_applyL
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_profile_AbstractNativeProfile_free(JNIEnv *env, jclass claz,
                                                                          jlong handle) {
-  delete jni_handle<profile>(env, handle);
+  delete jni_release_handle<profile>(env, handle);
 }
\ No newline at end of file
@@ -44,5 +44,5 @@ JNIEXPORT jdouble JNICALL Java_grpl_pathfinder_transmission_AbstractDcTransmissi
 
 JNIEXPORT void JNICALL Java_grpl_pathfinder_transmission_AbstractDcTransmission_free(JNIEnv *env, jclass claz,
                                                                                      jlong handle) {
-  delete jni_handle<dc_transmission>(env, handle);
+  delete jni_release_handle<dc_transmission>(env, handle);
 }
@@ -1,59 +1,174 @@
 #include "grpl_pathfinder_transmission_JavaDcTransmissionAdapter.h"
 #include "jnihandle.h"
+#include "jniregistry.h"
 #include "jniutil.h"
 
 #include <grpl/pf/transmission/dc.h>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 using namespace grpl::pf::transmission;
 
+// Adapter calling into a Java transmission on every call. The JNIEnv is fetched from the VM on each call,
+// such that the adapter may be used from any thread.
 class java_dc_transmission_adapter : public dc_transmission {
  public:
-  java_dc_transmission_adapter(JNIEnv *env, jobject obj) : _env(env) {
-    _obj       = env->NewGlobalRef(obj);
-    _freespeed = jni_get_method_id(env, obj, "getFreeSpeed", "(D)D");
-    _current   = jni_get_method_id(env, obj, "getCurrent", "(DD)D");
-    _torque    = jni_get_method_id(env, obj, "getTorque", "(D)D");
-    _freevolt  = jni_get_method_id(env, obj, "getFreeVoltage", "(D)D");
-    _currvolt  = jni_get_method_id(env, obj, "getCurrentVoltage", "(D)D");
-    _torcurr   = jni_get_method_id(env, obj, "getTorqueCurrent", "(D)D");
-    _nomvolt   = jni_get_method_id(env, obj, "getNominalVoltage", "()D");
-  }
+  java_dc_transmission_adapter(JNIEnv *env, jobject obj) : _obj(env->NewGlobalRef(obj)) {}
 
-  virtual ~java_dc_transmission_adapter() { _env->DeleteGlobalRef(_obj); }
+  virtual ~java_dc_transmission_adapter() { env()->DeleteGlobalRef(_obj); }
 
   double get_free_speed(double voltage) const override {
-    return _env->CallDoubleMethod(_obj, _freespeed, voltage);
+    return env()->CallDoubleMethod(_obj, jni_cache.dc_transmission.free_speed, voltage);
   }
 
   double get_current(double voltage, double speed) const override {
-    return _env->CallDoubleMethod(_obj, _current, voltage, speed);
+    return env()->CallDoubleMethod(_obj, jni_cache.dc_transmission.current, voltage, speed);
   }
 
-  double get_torque(double current) const override { return _env->CallDoubleMethod(_obj, _torque, current); }
+  double get_torque(double current) const override {
+    return env()->CallDoubleMethod(_obj, jni_cache.dc_transmission.torque, current);
+  }
 
   double get_free_voltage(double speed) const override {
-    return _env->CallDoubleMethod(_obj, _freevolt, speed);
+    return env()->CallDoubleMethod(_obj, jni_cache.dc_transmission.free_voltage, speed);
   }
 
   double get_current_voltage(double current) const override {
-    return _env->CallDoubleMethod(_obj, _currvolt, current);
+    return env()->CallDoubleMethod(_obj, jni_cache.dc_transmission.current_voltage, current);
   }
 
   double get_torque_current(double torque) const override {
-    return _env->CallDoubleMethod(_obj, _torcurr, torque);
+    return env()->CallDoubleMethod(_obj, jni_cache.dc_transmission.torque_current, torque);
+  }
+
+  double nominal_voltage() const override {
+    return env()->CallDoubleMethod(_obj, jni_cache.dc_transmission.nominal_voltage);
+  }
+
+ private:
+  static JNIEnv *env() { return jni_current_env(jni_cache.vm); }
+
+  jobject _obj;
+};
+
+// Uniform samples over [-range, range]. Values between samples are interpolated linearly, and values
+// beyond the range extrapolated from the nearest interval. This is exact for linear (and affine)
+// functions, such as those of a DC motor.
+struct sample_axis {
+  double range;
+  int    samples;
+
+  double position(int i) const { return -range + 2 * range * i / (samples - 1); }
+
+  // The index of the sample starting the interval containing x, and the position of x within it.
+  int locate(double x, double &u) const {
+    double step = 2 * range / (samples - 1);
+    int    i    = static_cast<int>(std::floor((x + range) / step));
+    i           = std::max(0, std::min(samples - 2, i));
+    u           = (x - position(i)) / step;
+    return i;
+  }
+};
+
+// A function of one variable, sampled over a sample_axis.
+class sampled_function {
+ public:
+  sampled_function() = default;
+
+  template <typename func_t>
+  sampled_function(sample_axis axis, func_t func) : _axis(axis), _values(axis.samples) {
+    for (int i = 0; i < axis.samples; i++) _values[i] = func(axis.position(i));
+  }
+
+  double operator()(double x) const {
+    double u;
+    int    i = _axis.locate(x, u);
+    return (1 - u) * _values[i] + u * _values[i + 1];
+  }
+
+ private:
+  sample_axis         _axis{1, 2};
+  std::vector<double> _values;
+};
+
+// A Java transmission sampled once into native lookup tables on construction. No calls are made into Java
+// afterwards, so the transmission is as cheap as a native transmission and safe to use from any thread,
+// at the cost of approximating a nonlinear transmission between samples. The tables span twice the
+// nominal voltage, free speed, stall current and stall torque of the transmission, and are extrapolated
+// linearly beyond it.
+class java_dc_transmission_snapshot : public dc_transmission {
+ public:
+  java_dc_transmission_snapshot(JNIEnv *env, jobject obj, int samples) {
+    jmethodID freespeed = jni_cache.dc_transmission.free_speed;
+    jmethodID current   = jni_cache.dc_transmission.current;
+    jmethodID torque    = jni_cache.dc_transmission.torque;
+    jmethodID freevolt  = jni_cache.dc_transmission.free_voltage;
+    jmethodID currvolt  = jni_cache.dc_transmission.current_voltage;
+    jmethodID torcurr   = jni_cache.dc_transmission.torque_current;
+    jmethodID nomvolt   = jni_cache.dc_transmission.nominal_voltage;
+
+    _nominal_voltage = env->CallDoubleMethod(obj, nomvolt);
+
+    double voltage_range = 2 * std::abs(_nominal_voltage);
+    double speed_range   = 2 * std::abs(env->CallDoubleMethod(obj, freespeed, _nominal_voltage));
+    double current_range = 2 * std::abs(env->CallDoubleMethod(obj, current, _nominal_voltage, 0.0));
+    double torque_range  = 2 * std::abs(env->CallDoubleMethod(obj, torque, current_range / 2));
+
+    sample_axis voltage_axis{voltage_range, samples}, speed_axis{speed_range, samples};
+    sample_axis current_axis{current_range, samples}, torque_axis{torque_range, samples};
+
+    _free_speed      = sampled_function(voltage_axis, [&](double v) { return call(env, obj, freespeed, v); });
+    _torque          = sampled_function(current_axis, [&](double i) { return call(env, obj, torque, i); });
+    _free_voltage    = sampled_function(speed_axis, [&](double w) { return call(env, obj, freevolt, w); });
+    _current_voltage = sampled_function(current_axis, [&](double i) { return call(env, obj, currvolt, i); });
+    _torque_current  = sampled_function(torque_axis, [&](double t) { return call(env, obj, torcurr, t); });
+
+    // Current is a function of both voltage and speed, sampled as a table of speed for each voltage.
+    _voltage_axis = voltage_axis;
+    for (int i = 0; i < samples; i++) {
+      double v = voltage_axis.position(i);
+      _current.emplace_back(speed_axis, [&](double w) { return env->CallDoubleMethod(obj, current, v, w); });
+    }
   }
 
-  double nominal_voltage() const override { return _env->CallDoubleMethod(_obj, _nomvolt); }
+  double get_free_speed(double voltage) const override { return _free_speed(voltage); }
+
+  double get_current(double voltage, double speed) const override {
+    // Bilinear: interpolate between the speed tables of the two nearest voltage samples.
+    double u;
+    int    i = _voltage_axis.locate(voltage, u);
+    return (1 - u) * _current[i](speed) + u * _current[i + 1](speed);
+  }
+
+  double get_torque(double current) const override { return _torque(current); }
+
+  double get_free_voltage(double speed) const override { return _free_voltage(speed); }
+
+  double get_current_voltage(double current) const override { return _current_voltage(current); }
+
+  double get_torque_current(double torque) const override { return _torque_current(torque); }
+
+  double nominal_voltage() const override { return _nominal_voltage; }
 
  private:
-  JNIEnv *  _env;
-  jobject   _obj;
-  jmethodID _freespeed, _current, _torque;
-  jmethodID _freevolt, _currvolt, _torcurr;
-  jmethodID _nomvolt;
+  static double call(JNIEnv *env, jobject obj, jmethodID method, double x) {
+    return env->CallDoubleMethod(obj, method, x);
+  }
+
+  double                        _nominal_voltage;
+  sampled_function              _free_speed, _torque, _free_voltage, _current_voltage, _torque_current;
+  sample_axis                   _voltage_axis{1, 2};
+  std::vector<sampled_function> _current;
 };
 
 JNIEXPORT jlong JNICALL Java_grpl_pathfinder_transmission_JavaDcTransmissionAdapter_allocate(
     JNIEnv *env, jclass claz, jobject javaobj) {
   return jni_as_handle<dc_transmission>(new java_dc_transmission_adapter(env, javaobj));
-}
\ No newline at end of file
+}
+
+JNIEXPORT jlong JNICALL Java_grpl_pathfinder_transmission_JavaDcTransmissionAdapter_allocateSnapshot(
+    JNIEnv *env, jclass claz, jobject javaobj, jint samples) {
+  return jni_as_handle<dc_transmission>(new java_dc_transmission_snapshot(env, javaobj, samples));
+}
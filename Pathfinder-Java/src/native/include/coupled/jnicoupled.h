@@ -1,8 +1,85 @@
 #pragma once
 
 #include <Eigen/Dense>
+#include <memory>
+#include <vector>
+#include "grpl/pf/coupled/chassis.h"
 #include "grpl/pf/coupled/state.h"
+#include "grpl/pf/profile/profile.h"
+#include "grpl/pf/util/task_executor.h"
 #include "jnieigen.h"
 #include "jniutil.h"
+#include "path/jnipath.h"
 
-grpl::pf::coupled::state jni_coupled_java_to_state(JNIEnv *env, jdoubleArray arr);
\ No newline at end of file
+// Number of doubles in a state exchanged with Java. See CoupledState.toArray() and CoupledStateBuffer.
+constexpr int jni_coupled_state_size = 10;
+// Number of doubles in a wheel state exchanged with Java. See CoupledWheelState.toArray().
+constexpr int jni_coupled_wheel_state_size = 9;
+
+grpl::pf::coupled::state jni_coupled_java_to_state(JNIEnv *env, jdoubleArray arr);
+
+grpl::pf::coupled::state jni_coupled_buffer_to_state(const double *buf);
+void                     jni_coupled_state_to_buffer(const grpl::pf::coupled::state &st, double *buf);
+void jni_coupled_wheel_state_to_buffer(const grpl::pf::coupled::wheel_state &ws, double *buf);
+
+// Address of a direct buffer holding a state, or nullptr (with an exception thrown) if the buffer is not
+// direct or is too small.
+double *jni_coupled_direct_state(JNIEnv *env, jobject buffer);
+
+// A generated trajectory, held in native memory in structure-of-arrays form and read in place by Java
+// through a direct buffer per column. The columns are stored consecutively in a single block, each of
+// size doubles, in the order of jni_trajectory::column. See Trajectory.java.
+struct jni_trajectory {
+  // Matches the column constants of Trajectory.java.
+  enum column : int {
+    time,
+    x,
+    y,
+    heading,
+    distance,
+    velocity,
+    acceleration,
+    curvature,
+    dcurvature,
+    left_voltage,
+    right_voltage,
+    column_count
+  };
+
+  std::vector<double> data;
+  size_t              size     = 0;
+  bool                finished = false;
+
+  double *col(column c) { return data.data() + c * size; }
+};
+
+// Fill a trajectory with a sequence of centre states, splitting them into the left and right wheel voltages
+// with the chassis.
+void jni_trajectory_assign(jni_trajectory &traj, const grpl::pf::coupled::chassis &chassis,
+                           const std::vector<grpl::pf::coupled::state> &states);
+
+// Everything needed to generate a trajectory from waypoints. The parameterizer, and the goal and limits of
+// the profile, are copied such that the Java thread may carry on using (and reconfiguring) them while the
+// trajectory is generated in the background. The chassis and profile themselves are shared, and only used
+// through their const (thread-safe) methods.
+struct jni_trajectory_request {
+  std::vector<grpl::pf::path::hermite_quintic::waypoint> waypoints;
+  grpl::pf::path::arc_parameterizer                      param;
+  const grpl::pf::coupled::chassis *                     chassis;
+  const grpl::pf::profile::profile *                     prof;
+  grpl::pf::profile::profile::context                    profile_ctx;
+  double                                                 dt, timeout;
+};
+
+// Generate a trajectory from waypoints: hermite -> parameterize -> generate -> split. If a task is given,
+// cancellation is checked between stages and periodically during generation, leaving the trajectory empty
+// if cancelled.
+void jni_trajectory_generate(const jni_trajectory_request &                 req,
+                             const grpl::pf::util::task_executor::task *task, jni_trajectory &out);
+
+// A trajectory being generated in the background. The result is shared with the task, so outlives the
+// future if the future is freed while the task is still running. See TrajectoryFuture.java.
+struct jni_trajectory_future {
+  grpl::pf::util::task_executor::task_ptr task;
+  std::shared_ptr<jni_trajectory>         result;
+};
@@ -2,15 +2,73 @@
 
 #include <jni.h>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 jfieldID jni_get_handle_field(JNIEnv *env, jobject obj);
 
+// Throw a grpl.pathfinder.util.ClosedException, for a handle that is closed (zero), freed or invalid.
+void jni_throw_closed(JNIEnv *env);
+
+// Table of the native objects owned by Java, indexed by handle. Java is handed a handle into this table
+// rather than a raw pointer. Each handle carries the generation of its slot, which is bumped when the
+// object is released, such that a stale (already freed) or invalid handle is rejected instead of
+// dereferencing freed memory.
+//
+// Handles are (generation << 32 | index + 1), so are never zero (the handle of a closed NativeResource).
+// Slots are allocated in fixed chunks that never move, such that lookups need no lock.
+class jni_handle_table {
+ public:
+  jlong insert(void *ptr);
+  void *remove(jlong handle);
+
+  void *get(jlong handle) const {
+    uint64_t h = static_cast<uint64_t>(handle);
+    uint64_t i = (h & 0xFFFFFFFFu) - 1;
+    if (i >= max_chunks * chunk_size) return nullptr;
+
+    const slot *chunk = _chunks[i / chunk_size].load(std::memory_order_acquire);
+    if (chunk == nullptr) return nullptr;
+
+    const slot &s   = chunk[i % chunk_size];
+    uint32_t    gen = static_cast<uint32_t>(h >> 32);
+    void *      ptr = s.ptr.load(std::memory_order_acquire);
+    // Checked after reading the pointer, so a concurrent release (and reuse) of the slot is never missed.
+    return s.generation.load(std::memory_order_acquire) == gen ? ptr : nullptr;
+  }
+
+ private:
+  static constexpr size_t chunk_size = 1024;
+  static constexpr size_t max_chunks = 4096;
+
+  struct slot {
+    std::atomic<uint32_t> generation{1};
+    std::atomic<void *>   ptr{nullptr};
+  };
+
+  std::atomic<slot *>   _chunks[max_chunks]{};
+  std::mutex            _mutex;
+  std::vector<uint32_t> _free;
+  uint32_t              _size = 0;
+};
+
+extern jni_handle_table jni_handles;
+
 template <typename T>
 T *jni_handle(JNIEnv *env, jlong handle) {
-  T *t = reinterpret_cast<T *>(handle);
-  if (t == nullptr) {
-    const char *exbuff = "This object is closed!";
-    env->ThrowNew(env->FindClass("grpl/pathfinder/util/ClosedException"), exbuff);
-  }
+  T *t = static_cast<T *>(jni_handles.get(handle));
+  if (t == nullptr) jni_throw_closed(env);
+  return t;
+}
+
+// Remove an object from the handle table, invalidating its handle, and return it to be destroyed.
+template <typename T>
+T *jni_release_handle(JNIEnv *env, jlong handle) {
+  T *t = static_cast<T *>(jni_handles.remove(handle));
+  if (t == nullptr) jni_throw_closed(env);
   return t;
 }
 
@@ -21,12 +79,11 @@ T *jni_get_handle(JNIEnv *env, jobject obj) {
 }
 
 template <typename T>
-void jni_set_handle(JNIEnv *env, jobject obj, T *t) {
-  jlong handle = reinterpret_cast<jlong>(t);
-  env->SetLongField(obj, jni_get_handle_field(env, obj), handle);
+jlong jni_as_handle(T *t) {
+  return jni_handles.insert(static_cast<void *>(t));
 }
 
 template <typename T>
-jlong jni_as_handle(T *t) {
-  return reinterpret_cast<jlong>(t);
-}
\ No newline at end of file
+void jni_set_handle(JNIEnv *env, jobject obj, T *t) {
+  env->SetLongField(obj, jni_get_handle_field(env, obj), jni_as_handle<T>(t));
+}
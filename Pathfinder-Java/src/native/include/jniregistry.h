@@ -0,0 +1,37 @@
+#pragma once
+
+#include <jni.h>
+
+// Classes, fields and methods used by the native library, resolved once when the library is loaded
+// (JNI_OnLoad) rather than on each native call or each construction of an adapter. Classes are held as
+// global references, so the IDs remain valid for the lifetime of the library.
+struct jni_registry {
+  JavaVM *vm;
+
+  jclass closed_exception;
+  jclass illegal_argument_exception;
+
+  // grpl.pathfinder.util.NativeResource
+  jfieldID native_resource_handle;
+
+  // grpl.pathfinder.profile.Profile$State
+  struct {
+    jclass    cls;
+    jmethodID init;
+    jfieldID  time, kinematics;
+  } profile_state;
+
+  // grpl.pathfinder.transmission.DcTransmission
+  struct {
+    jmethodID free_speed, current, torque;
+    jmethodID free_voltage, current_voltage, torque_current;
+    jmethodID nominal_voltage;
+  } dc_transmission;
+
+  // grpl.pathfinder.path.Spline2d
+  struct {
+    jmethodID sample;
+  } spline2d;
+};
+
+extern jni_registry jni_cache;
@@ -2,6 +2,7 @@
 
 #include <jni.h>
 #include <vector>
+#include "jnihandle.h"
 
 jfieldID  jni_get_field_id(JNIEnv *env, jobject obj, const char *name, const char *sig);
 jmethodID jni_get_method_id(JNIEnv *env, jobject obj, const char *name, const char *sig);
@@ -23,13 +24,18 @@ void jni_set_field(JNIEnv *env, jobject obj, const char *name, const char *sig,
 
 jobject jni_construct(JNIEnv *env, const char *cls_name, const char *sig, ...);
 
+// The JNIEnv of the calling thread, attaching the thread to the VM (as a daemon) if it is not already
+// attached. A JNIEnv is only valid on its own thread, so native code that may run on any thread (such as
+// a worker thread) must keep the JavaVM instead and fetch the JNIEnv with this on each use.
+JNIEnv *jni_current_env(JavaVM *vm);
+
 template <typename T>
 jlongArray jni_copy_to_handles(JNIEnv *env, std::vector<T> &vec) {
   jlong *addr = new jlong[vec.size()];
   size_t i    = 0;
   for (typename std::vector<T>::iterator it = vec.begin(); it != vec.end(); ++it) {
     // Create a copy of T somewhere on the heap, since it's now Javas to deal with.
-    addr[i++] = reinterpret_cast<jlong>(new T(*it));
+    addr[i++] = jni_as_handle<T>(new T(*it));
   }
 
   jlongArray arr = env->NewLongArray(vec.size());
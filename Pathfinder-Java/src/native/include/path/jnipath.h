@@ -0,0 +1,23 @@
+#pragma once
+
+#include <jni.h>
+#include <vector>
+#include "grpl/pf/path/arc_parameterizer.h"
+#include "grpl/pf/path/hermite.h"
+
+// Native storage of a CurveBuffer: a single contiguous arena of curves, owned by one handle.
+using jni_curve_buffer_t = std::vector<grpl::pf::path::arc_parameterizer::curve_t>;
+
+// Number of doubles in a quintic hermite waypoint exchanged with Java: the position, tangent and change in
+// tangent, each x then y. See HermiteQuintic.Waypoint.
+constexpr int jni_quintic_waypoint_size = 6;
+
+// Read a flat array of quintic hermite waypoints, of jni_quintic_waypoint_size doubles each.
+std::vector<grpl::pf::path::hermite_quintic::waypoint> jni_path_quintic_waypoints(JNIEnv *     env,
+                                                                                  jdoubleArray arr);
+
+// Fit quintic hermite splines through a sequence of waypoints and parameterize them into arcs, appending the
+// arcs to curves. The parameterizer is only used through its const (thread-safe) methods.
+void jni_path_parameterize_quintic(const grpl::pf::path::arc_parameterizer &                   param,
+                                   const std::vector<grpl::pf::path::hermite_quintic::waypoint> &waypoints,
+                                   jni_curve_buffer_t &                                          curves);
@@ -3,6 +3,7 @@ package grpl.pathfinder.coupled;
 import grpl.pathfinder.Vec2;
 import grpl.pathfinder.path.ArcParameterizer;
 import grpl.pathfinder.path.Curve2d;
+import grpl.pathfinder.path.CurveBuffer;
 import grpl.pathfinder.path.HermiteFactory;
 import grpl.pathfinder.path.HermiteQuintic;
 import grpl.pathfinder.profile.TrapezoidalProfile;
@@ -15,6 +16,10 @@ import java.io.IOException;
 import java.io.Writer;
 import java.util.ArrayList;
 import java.util.List;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.TimeUnit;
+
+import static org.junit.jupiter.api.Assertions.*;
 
 public class CoupledTest {
 
@@ -101,4 +106,193 @@ public class CoupledTest {
         profile.close();
 
     }
+
+    @Test
+    public void testCdtDirectBuffer() {
+        TrapezoidalProfile profile = new TrapezoidalProfile();
+
+        List<HermiteQuintic.Waypoint> waypoints = new ArrayList<>();
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(0, 0), Vec2.cartesian(5, 0), Vec2.cartesian(0, 0)));
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(4, 4), Vec2.cartesian(0, 5), Vec2.cartesian(0, 0)));
+
+        List<HermiteQuintic> hermites = HermiteFactory.generateQuintic(waypoints);
+        ArcParameterizer param = new ArcParameterizer();
+        param.configure(0.01, 0.01);
+        List<? extends Curve2d> curves = param.parameterize(hermites);
+
+        TrapezoidalProfile profileDirect = new TrapezoidalProfile();
+        CoupledCausalTrajGen genDirect = new CoupledCausalTrajGen(chassis);
+        gen.configure(curves, profile);
+        genDirect.configure(curves, profileDirect);
+
+        CoupledState state = new CoupledState();
+        // The same buffer is used for the last state and the output.
+        CoupledStateBuffer buffer = new CoupledStateBuffer();
+
+        for (double t = 0; !state.finished && t < 5; t += 0.01) {
+            state = gen.generate(state, t);
+            genDirect.generate(buffer, buffer, t);
+
+            assertEquals(state.finished, buffer.finished());
+            assertEquals(state.kinematics, buffer.toState().kinematics);
+            assertEquals(state.config, buffer.toState().config);
+        }
+
+        assertTrue(buffer.finished());
+
+        genDirect.close();
+        param.close();
+        profile.close();
+        profileDirect.close();
+    }
+
+    @Test
+    public void testCdtBatch() {
+        TrapezoidalProfile profile = new TrapezoidalProfile();
+
+        List<HermiteQuintic.Waypoint> waypoints = new ArrayList<>();
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(0, 0), Vec2.cartesian(5, 0), Vec2.cartesian(0, 0)));
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(4, 4), Vec2.cartesian(0, 5), Vec2.cartesian(0, 0)));
+
+        List<HermiteQuintic> hermites = HermiteFactory.generateQuintic(waypoints);
+        ArcParameterizer param = new ArcParameterizer();
+        param.configure(0.01, 0.01);
+        List<? extends Curve2d> curves = param.parameterize(hermites);
+
+        TrapezoidalProfile profileBatch = new TrapezoidalProfile();
+        CoupledCausalTrajGen genBatch = new CoupledCausalTrajGen(chassis);
+        gen.configure(curves, profile);
+        genBatch.configure(curves, profileBatch);
+
+        int maxSteps = 500;
+        double[] states = new double[maxSteps * CoupledStateBuffer.SIZE];
+        double[] wheels = new double[maxSteps * 2 * CoupledWheelState.SIZE];
+        int count = genBatch.generateBatch(new CoupledState(), 0.01, maxSteps, states, wheels);
+
+        assertTrue(count > 0 && count < maxSteps);
+
+        CoupledState state = new CoupledState();
+        double[] arr = new double[CoupledStateBuffer.SIZE];
+        double[] wheelArr = new double[CoupledWheelState.SIZE];
+        for (int i = 0; i < count; i++) {
+            state = gen.generate(state, (i + 1) * 0.01);
+
+            System.arraycopy(states, i * CoupledStateBuffer.SIZE, arr, 0, CoupledStateBuffer.SIZE);
+            CoupledState batchState = new CoupledState(arr);
+            assertEquals(state.finished, batchState.finished);
+            assertEquals(state.kinematics, batchState.kinematics);
+
+            CoupledWheelState[] split = chassis.split(state);
+            System.arraycopy(wheels, (2 * i + 1) * CoupledWheelState.SIZE, wheelArr, 0, CoupledWheelState.SIZE);
+            assertEquals(split[CoupledCausalTrajGen.RIGHT].kinematics, new CoupledWheelState(wheelArr).kinematics);
+        }
+
+        assertTrue(state.finished);
+
+        genBatch.close();
+        param.close();
+        profile.close();
+        profileBatch.close();
+    }
+
+    @Test
+    public void testCdtCurveBuffer() {
+        TrapezoidalProfile profile = new TrapezoidalProfile();
+
+        List<HermiteQuintic.Waypoint> waypoints = new ArrayList<>();
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(0, 0), Vec2.cartesian(5, 0), Vec2.cartesian(0, 0)));
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(4, 4), Vec2.cartesian(0, 5), Vec2.cartesian(0, 0)));
+
+        List<HermiteQuintic> hermites = HermiteFactory.generateQuintic(waypoints);
+        ArcParameterizer param = new ArcParameterizer();
+        param.configure(0.01, 0.01);
+        List<? extends Curve2d> curves = param.parameterize(hermites);
+        CurveBuffer buffer = param.parameterizeToBuffer(hermites);
+
+        TrapezoidalProfile profileBuffer = new TrapezoidalProfile();
+        CoupledCausalTrajGen genBuffer = new CoupledCausalTrajGen(chassis);
+        gen.configure(curves, profile);
+        genBuffer.configure(buffer, profileBuffer);
+
+        CoupledState state = new CoupledState(), stateBuffer = new CoupledState();
+        for (double t = 0; !state.finished && t < 5; t += 0.01) {
+            state = gen.generate(state, t);
+            stateBuffer = genBuffer.generate(stateBuffer, t);
+
+            assertEquals(state.kinematics, stateBuffer.kinematics);
+            assertEquals(state.config, stateBuffer.config);
+        }
+
+        assertTrue(stateBuffer.finished);
+
+        genBuffer.close();
+        buffer.close();
+        param.close();
+        profile.close();
+        profileBuffer.close();
+    }
+
+    @Test
+    public void testAsyncTrajGen() throws Exception {
+        TrapezoidalProfile profile = new TrapezoidalProfile();
+
+        List<HermiteQuintic.Waypoint> waypoints = new ArrayList<>();
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(0, 0), Vec2.cartesian(5, 0), Vec2.cartesian(0, 0)));
+        waypoints.add(new HermiteQuintic.Waypoint(Vec2.cartesian(4, 4), Vec2.cartesian(0, 5), Vec2.cartesian(0, 0)));
+
+        List<HermiteQuintic> hermites = HermiteFactory.generateQuintic(waypoints);
+        ArcParameterizer param = new ArcParameterizer();
+        param.configure(0.01, 0.01);
+        gen.configure(param.parameterize(hermites), profile);
+
+        TrapezoidalProfile profileAsync = new TrapezoidalProfile();
+        CoupledAsyncTrajGen genAsync = new CoupledAsyncTrajGen(chassis, 2);
+
+        TrajectoryFuture future = genAsync.submit(waypoints, param, profileAsync, 0.01, CoupledAsyncTrajGen.Priority.URGENT);
+        Trajectory traj = future.get(10, TimeUnit.SECONDS);
+        assertTrue(future.isDone());
+        assertFalse(future.isCancelled());
+        assertTrue(traj.finished());
+
+        // Matches the causal generator, one state at a time.
+        List<CoupledState> states = gen.generateAll(new CoupledState(), 0.01, 1000);
+        assertEquals(states.size(), traj.size());
+        for (int i = 0; i < traj.size(); i++) {
+            CoupledState state = traj.state(i);
+            assertEquals(states.get(i).kinematics, state.kinematics);
+            assertEquals(states.get(i).time, traj.time().get(i));
+            assertEquals(states.get(i).kinematics.velocity, traj.get(Trajectory.VELOCITY, i));
+
+            // Voltages match splitting each state with the chassis.
+            CoupledWheelState[] wheels = chassis.split(states.get(i));
+            assertEquals(wheels[0].voltage, traj.leftVoltage().get(i), 1e-9);
+            assertEquals(wheels[1].voltage, traj.rightVoltage().get(i), 1e-9);
+        }
+        assertTrue(traj.state(traj.size() - 1).finished);
+        assertEquals(traj.size(), traj.column(Trajectory.CURVATURE).capacity());
+        assertTrue(traj.x().isDirect());
+        assertTrue(traj.x().isReadOnly());
+
+        // Generating on the calling thread, in one native call, matches generating in the background.
+        try (Trajectory sync = Trajectory.generate(chassis, waypoints, param, profileAsync, 0.01)) {
+            assertEquals(traj.size(), sync.size());
+            assertTrue(sync.finished());
+            for (int c = 0; c < Trajectory.COLUMNS; c++)
+                assertEquals(traj.column(c), sync.column(c));
+        }
+
+        // A cancelled request never produces a trajectory.
+        TrajectoryFuture cancelled = genAsync.submit(waypoints, param, profileAsync, 0.01);
+        if (cancelled.cancel(true))
+            assertThrows(CancellationException.class, cancelled::get);
+        assertTrue(cancelled.isDone());
+
+        traj.close();
+        future.close();
+        cancelled.close();
+        genAsync.close();
+        param.close();
+        profile.close();
+        profileAsync.close();
+    }
 }
@@ -8,6 +8,8 @@ import java.io.IOException;
 import java.util.ArrayList;
 import java.util.List;
 
+import static org.junit.jupiter.api.Assertions.*;
+
 public class ArcParameterizerTest {
 
     ArcParameterizer arcParam;
@@ -43,4 +45,111 @@ public class ArcParameterizerTest {
 //        writer.close();
     }
 
+    @Test
+    void testParameterizeToBuffer() {
+        List<Arc2d> arcs = arcParam.parameterize(nativeSplines);
+
+        try (CurveBuffer buffer = arcParam.parameterizeToBuffer(nativeSplines)) {
+            assertEquals(arcs.size(), buffer.size());
+
+            double[] lengths = buffer.lengths();
+            double[] distances = new double[arcs.size()];
+            double distance = 0;
+            for (int i = 0; i < arcs.size(); i++) {
+                assertEquals(arcs.get(i).length(), lengths[i], 1e-12);
+                distances[i] = distance;
+                distance += lengths[i];
+            }
+            assertEquals(distance, buffer.length(), 1e-9);
+
+            // Sampling at the start of each curve matches the start of each arc.
+            double[] samples = new double[CurveBuffer.SAMPLE_SIZE * distances.length];
+            buffer.sample(distances, samples);
+            for (int i = 0; i < arcs.size(); i++) {
+                Vec2 pos = arcs.get(i).position(0);
+                assertEquals(pos.x(), samples[CurveBuffer.SAMPLE_SIZE * i], 1e-6);
+                assertEquals(pos.y(), samples[CurveBuffer.SAMPLE_SIZE * i + 1], 1e-6);
+            }
+        }
+
+        for (Arc2d arc : arcs)
+            arc.close();
+    }
+
+    // A spline implemented in Java, evaluated by the native library through Spline2d.sample.
+    private static class JavaSpline implements Spline2d {
+        private final Spline2d spline;
+
+        JavaSpline(Spline2d spline) {
+            this.spline = spline;
+        }
+
+        @Override
+        public Vec2 position(double t) {
+            return spline.position(t);
+        }
+
+        @Override
+        public Vec2 derivative(double t) {
+            return spline.derivative(t);
+        }
+
+        @Override
+        public Vec2 rotation(double t) {
+            return spline.rotation(t);
+        }
+
+        @Override
+        public double curvature(double t) {
+            return spline.curvature(t);
+        }
+    }
+
+    @Test
+    void testParameterizeWaypoints() {
+        List<HermiteQuintic.Waypoint> wps = new ArrayList<>();
+        wps.add(new HermiteQuintic.Waypoint(Vec2.cartesian(2, 2), Vec2.cartesian(5, 0), Vec2.cartesian(0, 0)));
+        wps.add(new HermiteQuintic.Waypoint(Vec2.cartesian(5, 5), Vec2.cartesian(3, 2), Vec2.cartesian(0, 0)));
+        wps.add(new HermiteQuintic.Waypoint(Vec2.cartesian(10, 5), Vec2.cartesian(0, 5), Vec2.cartesian(0, 0)));
+        List<HermiteQuintic> hermites = HermiteFactory.generateQuintic(wps);
+
+        // Matches parameterizing the splines built one at a time.
+        try (CurveBuffer expected = arcParam.parameterizeToBuffer(hermites);
+             CurveBuffer actual = arcParam.parameterizeWaypoints(wps)) {
+            assertEquals(expected.size(), actual.size());
+            assertArrayEquals(expected.lengths(), actual.lengths(), 1e-12);
+        }
+
+        assertThrows(IllegalArgumentException.class, () -> arcParam.parameterizeWaypoints(new double[5]));
+
+        for (HermiteQuintic hermite : hermites)
+            hermite.close();
+    }
+
+    @Test
+    void testParameterizeJavaSpline() {
+        List<Spline2d> javaSplines = new ArrayList<>();
+        for (Spline2d spline : nativeSplines)
+            javaSplines.add(new JavaSpline(spline));
+
+        try (CurveBuffer expected = arcParam.parameterizeToBuffer(nativeSplines);
+             CurveBuffer actual = arcParam.parameterizeToBuffer(javaSplines)) {
+            assertEquals(expected.length(), actual.length(), 1e-3);
+
+            double[] distances = new double[100];
+            for (int i = 0; i < distances.length; i++)
+                distances[i] = expected.length() * i / (distances.length - 1);
+
+            double[] samplesExpected = new double[CurveBuffer.SAMPLE_SIZE * distances.length];
+            double[] samplesActual = new double[CurveBuffer.SAMPLE_SIZE * distances.length];
+            expected.sample(distances, samplesExpected);
+            actual.sample(distances, samplesActual);
+
+            for (int i = 0; i < distances.length; i++) {
+                assertEquals(samplesExpected[CurveBuffer.SAMPLE_SIZE * i], samplesActual[CurveBuffer.SAMPLE_SIZE * i], 1e-2);
+                assertEquals(samplesExpected[CurveBuffer.SAMPLE_SIZE * i + 1], samplesActual[CurveBuffer.SAMPLE_SIZE * i + 1], 1e-2);
+            }
+        }
+    }
+
 }
@@ -0,0 +1,70 @@
+package grpl.pathfinder.transmission;
+
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.*;
+
+public class JavaDcTransmissionAdapterTest {
+
+    // A transmission implemented in Java, delegating to a native motor.
+    private static class JavaTransmission implements DcTransmission {
+        private final DcTransmission motor;
+
+        JavaTransmission(DcTransmission motor) {
+            this.motor = motor;
+        }
+
+        public double getFreeSpeed(double voltage) { return motor.getFreeSpeed(voltage); }
+
+        public double getCurrent(double voltage, double speed) { return motor.getCurrent(voltage, speed); }
+
+        public double getTorque(double current) { return motor.getTorque(current); }
+
+        public double getFreeVoltage(double speed) { return motor.getFreeVoltage(speed); }
+
+        public double getCurrentVoltage(double current) { return motor.getCurrentVoltage(current); }
+
+        public double getTorqueCurrent(double torque) { return motor.getTorqueCurrent(torque); }
+
+        public double getNominalVoltage() { return motor.getNominalVoltage(); }
+    }
+
+    DcMotor motor;
+    JavaDcTransmissionAdapter live, snapshot;
+
+    @BeforeEach
+    public void setup() {
+        // Dual CIM
+        motor = new DcMotor(12.0, 5330 * 2.0 * Math.PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0, 2 * 2.41 * 12.75);
+        live = new JavaDcTransmissionAdapter(new JavaTransmission(motor));
+        snapshot = JavaDcTransmissionAdapter.snapshot(new JavaTransmission(motor));
+    }
+
+    @AfterEach
+    public void tearDown() {
+        live.close();
+        snapshot.close();
+        motor.close();
+    }
+
+    @Test
+    public void testSnapshotMatchesMotor() {
+        // A DC motor is linear, so the snapshot is exact, including beyond the sampled range.
+        for (double x = -3; x <= 3; x += 0.37) {
+            double voltage = x * 12, speed = x * 40, current = x * 200, torque = x * 50;
+
+            assertEquals(motor.getFreeSpeed(voltage), snapshot.getFreeSpeed(voltage), 1e-9);
+            assertEquals(motor.getCurrent(voltage, speed), snapshot.getCurrent(voltage, speed), 1e-9);
+            assertEquals(motor.getTorque(current), snapshot.getTorque(current), 1e-9);
+            assertEquals(motor.getFreeVoltage(speed), snapshot.getFreeVoltage(speed), 1e-9);
+            assertEquals(motor.getCurrentVoltage(current), snapshot.getCurrentVoltage(current), 1e-9);
+            assertEquals(motor.getTorqueCurrent(torque), snapshot.getTorqueCurrent(torque), 1e-9);
+
+            assertEquals(motor.getCurrent(voltage, speed), live.getCurrent(voltage, speed), 1e-12);
+        }
+        assertEquals(motor.getNominalVoltage(), snapshot.getNominalVoltage(), 1e-12);
+    }
+
+}
@@ -16,4 +16,10 @@ public abstract class NativeResourceTest {
         assertTrue(nativeResource().closed());
     }
 
+    @Test
+    void testCloseTwice() throws Exception {
+        nativeResource().close();
+        assertThrows(ClosedException.class, () -> nativeResource().close());
+    }
+
 }
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "grpl/pf/path/hermite.h"
+
+#include <Eigen/Dense>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace benchutil {
+/**
+ * The shape of a synthetic path, see @ref synthetic_path.
+ *
+ * The heading of the path changes at each interior waypoint by a turn drawn uniformly from
+ * [-max_turn, max_turn], so the mean absolute curvature of the path is about
+ * (max_turn / 2) / segment_length.
+ */
+struct path_spec {
+  /** The number of waypoints, at least 2. */
+  size_t waypoints = 10;
+  /** The mean straight-line distance between consecutive waypoints, in metres. */
+  double segment_length = 1.0;
+  /** The spread of the segment lengths, drawn uniformly from segment_length * [1 - spread, 1 + spread]. */
+  double length_spread = 0.5;
+  /** The maximum change in heading at each waypoint, in radians. */
+  double max_turn = 0.5;
+  /** The seed of the generator. The same seed gives the same path on every platform. */
+  uint32_t seed = 1;
+};
+
+/**
+ * Generate a random, but deterministic, path of quintic hermite waypoints.
+ *
+ * Random numbers are drawn from the raw output of std::mt19937, which is fully specified by the standard,
+ * rather than through the std:: distributions, which are not, so a seed gives the same path with any
+ * standard library.
+ *
+ * Each waypoint is given a tangent of magnitude equal to the length of its adjacent segments, and a second
+ * derivative normal to the tangent such that the spline passes through the waypoint with the curvature of
+ * its turn.
+ */
+inline std::vector<grpl::pf::path::hermite_quintic::waypoint> synthetic_path(const path_spec &spec) {
+  using waypoint = grpl::pf::path::hermite_quintic::waypoint;
+
+  std::mt19937 rng{spec.seed};
+  auto         uniform = [&rng](double lo, double hi) {
+    return lo + (hi - lo) * (static_cast<double>(rng()) / 4294967296.0);
+  };
+
+  size_t              n = spec.waypoints < 2 ? 2 : spec.waypoints;
+  std::vector<double> lengths(n - 1), turns(n, 0.0);
+  for (size_t i = 0; i < n - 1; i++)
+    lengths[i] = spec.segment_length * uniform(1 - spec.length_spread, 1 + spec.length_spread);
+  for (size_t i = 1; i < n - 1; i++) turns[i] = uniform(-spec.max_turn, spec.max_turn);
+
+  std::vector<waypoint> wps;
+  wps.reserve(n);
+
+  Eigen::Vector2d position{0, 0};
+  double          heading = 0;
+  for (size_t i = 0; i < n; i++) {
+    // The heading at a waypoint bisects the turn, such that the turn is split between its two segments.
+    double          seg_in  = i > 0 ? lengths[i - 1] : lengths[i];
+    double          seg_out = i < n - 1 ? lengths[i] : lengths[i - 1];
+    double          seg     = (seg_in + seg_out) / 2.0;
+    double          curv    = turns[i] / seg;
+    double          wp_head = heading + turns[i] / 2.0;
+    Eigen::Vector2d tangent{cos(wp_head), sin(wp_head)};
+    Eigen::Vector2d normal{-tangent.y(), tangent.x()};
+
+    wps.push_back(waypoint{position, tangent * seg, normal * curv * seg * seg});
+
+    heading += turns[i];
+    if (i < n - 1) position += lengths[i] * Eigen::Vector2d{cos(heading), sin(heading)};
+  }
+  return wps;
+}
+}  // namespace benchutil
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Compare Google Benchmark JSON results against a baseline, flagging regressions.
+
+Usage:
+    compare.py BASELINE CURRENT [--threshold 0.1] [--metric cpu_time] [--filter REGEX]
+
+BASELINE and CURRENT are JSON files written by the benchmark runner with
+--benchmark_out=<file> --benchmark_out_format=json (the Gradle pathfinderBench run writes bench.json to its
+test-results directory). Where a benchmark was run with repetitions, the mean is compared.
+
+Exits with status 1 if any benchmark is slower than the baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+TIME_UNITS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def load(path, metric, pattern):
+    with open(path) as f:
+        data = json.load(f)
+
+    results, means = {}, {}
+    for bench in data.get('benchmarks', []):
+        name = bench['name']
+        # Complexity fits (_BigO, _RMS) are not timings.
+        if name.endswith('_BigO') or name.endswith('_RMS'):
+            continue
+        if pattern and not pattern.search(name):
+            continue
+
+        ns = bench[metric] * TIME_UNITS[bench.get('time_unit', 'ns')]
+        if bench.get('run_type') == 'aggregate':
+            if bench.get('aggregate_name') == 'mean':
+                means[bench['run_name']] = ns
+        else:
+            # Repetitions of the same benchmark are averaged if no mean aggregate is reported.
+            results.setdefault(bench.get('run_name', name), []).append(ns)
+
+    out = {name: sum(times) / len(times) for name, times in results.items()}
+    out.update(means)
+    return out, data.get('context', {})
+
+
+def fmt(ns):
+    for unit, scale in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+        if ns >= scale:
+            return '%.3f %s' % (ns / scale, unit)
+    return '%.1f ns' % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='relative slowdown flagged as a regression (default: 0.1, i.e. 10%%)')
+    parser.add_argument('--metric', choices=('cpu_time', 'real_time'), default='cpu_time')
+    parser.add_argument('--filter', help='only compare benchmarks matching this regex')
+    args = parser.parse_args()
+
+    pattern = re.compile(args.filter) if args.filter else None
+    baseline, base_ctx = load(args.baseline, args.metric, pattern)
+    current, curr_ctx = load(args.current, args.metric, pattern)
+
+    for key in ('host_name', 'num_cpus', 'mhz_per_cpu'):
+        if key in base_ctx and key in curr_ctx and base_ctx[key] != curr_ctx[key]:
+            print('warning: %s differs (baseline %s, current %s)' % (key, base_ctx[key], curr_ctx[key]))
+
+    width = max([len(n) for n in baseline.keys() | current.keys()] + [9])
+    print('%-*s  %12s  %12s  %8s' % (width, 'Benchmark', 'Baseline', 'Current', 'Change'))
+
+    regressions = []
+    for name in sorted(baseline.keys() & current.keys()):
+        base, curr = baseline[name], current[name]
+        change = (curr - base) / base if base > 0 else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = '  REGRESSION'
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = '  improved'
+        print('%-*s  %12s  %12s  %+7.1f%%%s' % (width, name, fmt(base), fmt(curr), 100 * change, flag))
+
+    for name in sorted(baseline.keys() - current.keys()):
+        print('%-*s  missing from current results' % (width, name))
+    for name in sorted(current.keys() - baseline.keys()):
+        print('%-*s  new (not in baseline)' % (width, name))
+
+    if regressions:
+        print('\n%d regression(s) above %.0f%%: %s' % (len(regressions), 100 * args.threshold,
+                                                     ', '.join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,48 @@
+#include "grpl/pf/coupled/batch_trajectory_generator.h"
+
+#include <array>
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Candidate path evaluation: generate a batch of 32 paths with the given number of worker threads, keeping
+// only the summary metrics of each.
+static void BM_Batch_Generate(benchmark::State &state) {
+  using hermite_t = path::hermite_quintic;
+  using batch_t   = coupled::batch_trajectory_generator<hermite_t>;
+
+  double G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  const size_t                                    N = 32;
+  std::vector<std::array<hermite_t::waypoint, 2>> paths(N);
+  std::vector<batch_t::request>                   requests(N);
+  std::vector<batch_t::result>                    results(N);
+
+  for (size_t i = 0; i < N; i++) {
+    paths[i] = {hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                hermite_t::waypoint{{4, 2 + 0.1 * i}, {0, 5}, {0, 0}}};
+    requests[i].waypoints      = paths[i].data();
+    requests[i].waypoint_count = paths[i].size();
+  }
+
+  util::thread_pool pool(static_cast<size_t>(state.range(0)));
+  batch_t           batch(pool, chassis, profile::trapezoidal{}, param, 8, 2048, 0.01);
+
+  for (auto _ : state) {
+    batch.generate(requests.data(), results.data(), N);
+    benchmark::DoNotOptimize(results.data());
+  }
+
+  state.counters["Threads"] = pool.size();
+  state.counters["Paths/s"] = benchmark::Counter(N, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(BM_Batch_Generate)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
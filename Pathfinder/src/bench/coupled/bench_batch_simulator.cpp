@@ -0,0 +1,66 @@
+#include "grpl/pf/coupled/batch_simulator.h"
+#include "grpl/pf/coupled/noncausal_trajectory_generator.h"
+#include "grpl/pf/path/arc_parameterizer.h"
+#include "grpl/pf/path/hermite.h"
+
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Monte Carlo validation of a single trajectory: simulate 1024 robots with perturbed mass, wheel radius and
+// battery voltage with the given number of worker threads, 4 RK4 steps per state.
+static void BM_Batch_Simulate(benchmark::State &state) {
+  using hermite_t   = path::hermite_quintic;
+  using chassis_t   = coupled::basic_chassis<transmission::dc_motor, transmission::dc_motor>;
+  using simulator_t = coupled::batch_simulator<chassis_t>;
+
+  double G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  chassis_t              chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::array<hermite_t::waypoint, 2> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                         hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}};
+  std::vector<hermite_t>             hermites;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             hermites.max_size());
+
+  std::vector<path::augmented_arc2d> curves;
+  path::arc_parameterizer            param;
+  param.configure(0.01, 0.01);
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.01);
+
+  std::vector<coupled::state> states(4096);
+  coupled::wheel_track        left(4096), right(4096);
+  size_t n = gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size());
+  chassis.split(states.begin(), states.begin() + n, left, right);
+
+  const size_t                         N = 1024;
+  std::mt19937                         rng(1234);
+  std::normal_distribution<double>     mass(25.0, 2.0), wheel(0.0762, 0.001), battery(12.0, 0.3);
+  std::vector<simulator_t::parameters> params;
+  for (size_t i = 0; i < N; i++)
+    params.push_back(simulator_t::parameters{mass(rng), wheel(rng), battery(rng)});
+
+  util::thread_pool pool(static_cast<size_t>(state.range(0)));
+  simulator_t       sim(chassis, N);
+  sim.set_parameters(params.begin(), params.end());
+
+  for (auto _ : state) {
+    sim.simulate(pool, left, right);
+    benchmark::DoNotOptimize(sim.max_error().data());
+  }
+
+  state.counters["Threads"]  = pool.size();
+  state.counters["States"]   = n;
+  state.counters["Robots/s"] = benchmark::Counter(N, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(BM_Batch_Simulate)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
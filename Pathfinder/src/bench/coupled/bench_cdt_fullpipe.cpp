@@ -3,6 +3,8 @@
 #include "grpl/pf/path/arc_parameterizer.h"
 #include "grpl/pf/profile/trapezoidal.h"
 
+#include "bench_util.h"
+
 #include <vector>
 
 using namespace grpl::pf;
@@ -66,4 +68,80 @@ static void BM_CDT_Full(benchmark::State &state) {
   state.SetComplexityN(state.range(0));
 }
 
-BENCHMARK(BM_CDT_Full)->Arg(10)->Arg(100)->Arg(1000)->Complexity()->Unit(benchmark::kMillisecond);
\ No newline at end of file
+BENCHMARK(BM_CDT_Full)->Arg(10)->Arg(100)->Arg(1000)->Complexity()->Unit(benchmark::kMillisecond);
+
+// The whole pipeline, from waypoints to a split trajectory at 100Hz, on a synthetic path of range(0)
+// waypoints. Registered twice, as Complexity() fits a single N per benchmark: against the number of
+// waypoints, and against the number of curves. As each step searches the curves linearly, the cost of
+// a path grows with the product of its length and curve count (N^2), so the range stops at 100 waypoints:
+// 1000 waypoints takes about a minute per iteration.
+static void cdt_full_path(benchmark::State &state, bool by_curves) {
+  using hermite_t = path::hermite_quintic;
+  using profile_t = profile::trapezoidal;
+
+  benchutil::path_spec spec;
+  spec.waypoints = static_cast<size_t>(state.range(0));
+
+  std::vector<hermite_t::waypoint> wps = benchutil::synthetic_path(spec);
+
+  double G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis    chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  std::vector<hermite_t> hermites;
+  hermites.reserve(wps.size());
+  std::vector<path::arc_parameterizer::curve_t> curves;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             wps.size());
+  curves.reserve(param.curve_count(hermites.begin(), hermites.end()));  // No reallocs during timing
+
+  size_t num_gens = 0;
+  double realtime = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    hermites.clear();
+    curves.clear();
+    profile_t                            profile;
+    coupled::causal_trajectory_generator gen;
+    coupled::state                       c_state;
+    state.ResumeTiming();
+
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.capacity());
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.capacity());
+
+    double t;
+    num_gens = 0;
+    for (t = 0; !c_state.finished && t < 3600.0; t += 0.01) {
+      c_state = gen.generate(chassis, curves.begin(), curves.end(), profile, c_state, t);
+      std::pair<coupled::wheel_state, coupled::wheel_state> split = chassis.split(c_state);
+      benchmark::DoNotOptimize(split);
+      num_gens++;
+    }
+    realtime = t;
+  }
+
+  state.counters["NumWaypoints"] = static_cast<double>(wps.size());
+  state.counters["NumCurves"]    = static_cast<double>(curves.size());
+  state.counters["NumStates"]    = static_cast<double>(num_gens);
+  state.counters["MPExecTime"]   = realtime;
+  state.SetComplexityN(by_curves ? static_cast<int64_t>(curves.size()) : state.range(0));
+}
+
+static void BM_CDT_FullPath_ByWaypoints(benchmark::State &state) {
+  cdt_full_path(state, false);
+}
+
+static void BM_CDT_FullPath_ByCurves(benchmark::State &state) {
+  cdt_full_path(state, true);
+}
+
+BENCHMARK(BM_CDT_FullPath_ByWaypoints)
+    ->Arg(2)->Arg(10)->Arg(30)->Arg(100)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CDT_FullPath_ByCurves)
+    ->Arg(2)->Arg(10)->Arg(30)->Arg(100)->Complexity()->Unit(benchmark::kMillisecond);
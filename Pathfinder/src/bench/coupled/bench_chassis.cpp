@@ -0,0 +1,169 @@
+#include "grpl/pf/coupled/chassis.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// The chassis calls made on every generation step: limits, then a split of the generated state.
+template <typename chassis_t>
+static void chassis_step(benchmark::State &state, const chassis_t &chassis) {
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+  coupled::state               centre;
+
+  double k = -5, v = 0;
+  for (auto _ : state) {
+    k = k > 5 ? -5 : k + 0.013;
+    v = v > 3 ? 0 : v + 0.007;
+
+    double                    vlim = chassis.linear_vel_limit(config, k);
+    std::pair<double, double> acc  = chassis.acceleration_limits(config, k, v);
+
+    centre.curvature                = k;
+    centre.kinematics[VELOCITY]     = std::min(v, vlim);
+    centre.kinematics[ACCELERATION] = acc.second;
+
+    std::pair<coupled::wheel_state, coupled::wheel_state> split = chassis.split(centre);
+    benchmark::DoNotOptimize(split);
+  }
+}
+
+static void BM_Chassis_StepVirtual(benchmark::State &state) {
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  // Hide the concrete type from the optimizer, as is the case when transmissions are provided at runtime.
+  transmission::dc_transmission *trans = &dualCIM;
+  benchmark::DoNotOptimize(trans);
+
+  coupled::chassis chassis{*trans, *trans, 0.0762, 0.5, 25.0};
+
+  chassis_step(state, chassis);
+}
+
+static void BM_Chassis_StepDevirtualized(benchmark::State &state) {
+  using chassis_t = coupled::basic_chassis<transmission::dc_motor, transmission::dc_motor>;
+
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  chassis_t              chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  chassis_step(state, chassis);
+}
+
+// The limit functions alone, over a sweep of curvature and velocity.
+static void BM_Chassis_LinearVelLimit(benchmark::State &state) {
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+
+  double k = -5;
+  for (auto _ : state) {
+    k = k > 5 ? -5 : k + 0.013;
+    benchmark::DoNotOptimize(chassis.linear_vel_limit(config, k));
+  }
+}
+
+static void BM_Chassis_AccelerationLimits(benchmark::State &state) {
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+
+  double k = -5, v = 0;
+  for (auto _ : state) {
+    k = k > 5 ? -5 : k + 0.013;
+    v = v > 3 ? 0 : v + 0.007;
+    benchmark::DoNotOptimize(chassis.acceleration_limits(config, k, v));
+  }
+}
+
+static void BM_Chassis_Split(benchmark::State &state) {
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  coupled::state centre;
+  centre.kinematics[VELOCITY]     = 2;
+  centre.kinematics[ACCELERATION] = 1;
+
+  double k = -5;
+  for (auto _ : state) {
+    k                = k > 5 ? -5 : k + 0.013;
+    centre.curvature = k;
+    benchmark::DoNotOptimize(chassis.split(centre));
+  }
+}
+
+BENCHMARK(BM_Chassis_LinearVelLimit);
+BENCHMARK(BM_Chassis_AccelerationLimits);
+BENCHMARK(BM_Chassis_Split);
+BENCHMARK(BM_Chassis_StepVirtual);
+BENCHMARK(BM_Chassis_StepDevirtualized);
+
+// A trajectory of N centre states, as would be generated for export to the motor controllers.
+static std::vector<coupled::state> split_states(size_t N) {
+  std::vector<coupled::state> states(N);
+  for (size_t i = 0; i < N; i++) {
+    states[i].time                     = i * 0.001;
+    states[i].curvature                = sin(i * 0.01);
+    states[i].dcurvature               = 0.01 * cos(i * 0.01);
+    states[i].config                   = coupled::configuration_state{0.001 * i, 0.002 * i,
+                                                                  remainder(i * 0.005, 2 * constants::PI)};
+    states[i].kinematics[VELOCITY]     = 2 + sin(i * 0.003);
+    states[i].kinematics[ACCELERATION] = cos(i * 0.003);
+  }
+  return states;
+}
+
+// Per-state split, as in BM_CDT_Full.
+static void BM_Chassis_SplitPerState(benchmark::State &state) {
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<coupled::state> states = split_states(static_cast<size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (const coupled::state &st : states) {
+      std::pair<coupled::wheel_state, coupled::wheel_state> split = chassis.split(st);
+      benchmark::DoNotOptimize(split);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_Chassis_SplitBatch(benchmark::State &state) {
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<coupled::state> states = split_states(static_cast<size_t>(state.range(0)));
+  coupled::wheel_track        left(states.size()), right(states.size());
+
+  for (auto _ : state) {
+    size_t n = chassis.split(states.begin(), states.end(), left, right);
+    benchmark::DoNotOptimize(n);
+    benchmark::DoNotOptimize(left.voltage().data());
+    benchmark::DoNotOptimize(right.voltage().data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_Chassis_SplitPerState)->RangeMultiplier(8)->Range(64, 32768)->Complexity();
+BENCHMARK(BM_Chassis_SplitBatch)->RangeMultiplier(8)->Range(64, 32768)->Complexity();
@@ -0,0 +1,45 @@
+#include "grpl/pf/coupled/chassis.h"
+#include "grpl/pf/coupled/chassis_envelope.h"
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// The limits queried on every generation step, from either the exact model or the envelope.
+template <typename chassis_t>
+static void limits_loop(benchmark::State &state, const chassis_t &limits) {
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+
+  double k = -5, v = 0;
+  for (auto _ : state) {
+    k = k > 5 ? -5 : k + 0.013;
+    v = v > 3 ? 0 : v + 0.007;
+
+    double                    vlim = limits.linear_vel_limit(config, k);
+    std::pair<double, double> acc  = limits.acceleration_limits(config, k, v);
+    benchmark::DoNotOptimize(vlim);
+    benchmark::DoNotOptimize(acc);
+  }
+}
+
+static void BM_Chassis_LimitsExact(benchmark::State &state) {
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  limits_loop(state, chassis);
+}
+
+static void BM_Chassis_LimitsEnvelope(benchmark::State &state) {
+  double                    G = 12.75;
+  transmission::dc_motor    dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis          chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+  coupled::chassis_envelope envelope{chassis};
+
+  limits_loop(state, envelope);
+}
+
+BENCHMARK(BM_Chassis_LimitsExact);
+BENCHMARK(BM_Chassis_LimitsEnvelope);
@@ -0,0 +1,101 @@
+#include "grpl/pf/coupled/chassis.h"
+#include "grpl/pf/coupled/constrained_chassis.h"
+#include "grpl/pf/coupled/constraints.h"
+
+#include <cmath>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// The limits evaluated on every generation step, for each constraint alone and for the chassis with and
+// without a composed constraint pipeline.
+
+using chassis_t = coupled::basic_chassis<transmission::dc_motor, transmission::dc_motor>;
+
+static transmission::dc_motor bench_motor() {
+  double G = 12.75;
+  return transmission::dc_motor{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                2 * 2.41 * G};
+}
+
+template <typename limits_t>
+static void limits_step(benchmark::State &state, const limits_t &limits) {
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+
+  double k = -5, v = 0;
+  for (auto _ : state) {
+    k = k > 5 ? -5 : k + 0.013;
+    v = v > 3 ? 0 : v + 0.007;
+
+    double                    vlim = limits.linear_vel_limit(config, k);
+    std::pair<double, double> acc  = limits.acceleration_limits(config, k, v);
+    benchmark::DoNotOptimize(vlim);
+    benchmark::DoNotOptimize(acc);
+  }
+}
+
+// A single constraint, presenting its limits under the names of the chassis.
+template <typename constraint_t>
+struct constraint_only {
+  constraint_t constraint;
+
+  double linear_vel_limit(const coupled::configuration_state &config, double k) const {
+    return constraint.velocity_limit(config, k);
+  }
+
+  std::pair<double, double> acceleration_limits(const coupled::configuration_state &config, double k,
+                                                double v) const {
+    return constraint.acceleration_limits(config, k, v);
+  }
+};
+
+template <typename constraint_t>
+static constraint_only<constraint_t> only(const constraint_t &constraint) {
+  return constraint_only<constraint_t>{constraint};
+}
+
+static void BM_Constraint_Centripetal(benchmark::State &state) {
+  limits_step(state, only(coupled::centripetal_constraint(2.0)));
+}
+
+static void BM_Constraint_Current(benchmark::State &state) {
+  transmission::dc_motor motor = bench_motor();
+  chassis_t              chassis{motor, motor, 0.0762, 0.5, 25.0};
+  limits_step(state, only(coupled::current_constraint<chassis_t>(chassis, 80)));
+}
+
+static void BM_Constraint_Voltage(benchmark::State &state) {
+  transmission::dc_motor motor = bench_motor();
+  chassis_t              chassis{motor, motor, 0.0762, 0.5, 25.0};
+  limits_step(state, only(coupled::voltage_constraint<chassis_t>(chassis, 11)));
+}
+
+// Today's two limits (linear_vel_limit and acceleration_limits) of the chassis alone.
+static void BM_Constraint_ChassisOnly(benchmark::State &state) {
+  transmission::dc_motor motor = bench_motor();
+  chassis_t              chassis{motor, motor, 0.0762, 0.5, 25.0};
+  limits_step(state, chassis);
+}
+
+// The chassis through an empty pipeline, measuring the overhead of the pipeline itself.
+static void BM_Constraint_PipelineEmpty(benchmark::State &state) {
+  transmission::dc_motor motor = bench_motor();
+  chassis_t              chassis{motor, motor, 0.0762, 0.5, 25.0};
+  limits_step(state, coupled::make_constrained_chassis(chassis));
+}
+
+static void BM_Constraint_PipelineAll(benchmark::State &state) {
+  transmission::dc_motor motor = bench_motor();
+  chassis_t              chassis{motor, motor, 0.0762, 0.5, 25.0};
+  limits_step(state, coupled::make_constrained_chassis(chassis, coupled::centripetal_constraint(2.0),
+                                                       coupled::current_constraint<chassis_t>(chassis, 80),
+                                                       coupled::voltage_constraint<chassis_t>(chassis, 11)));
+}
+
+BENCHMARK(BM_Constraint_Centripetal);
+BENCHMARK(BM_Constraint_Current);
+BENCHMARK(BM_Constraint_Voltage);
+BENCHMARK(BM_Constraint_ChassisOnly);
+BENCHMARK(BM_Constraint_PipelineEmpty);
+BENCHMARK(BM_Constraint_PipelineAll);
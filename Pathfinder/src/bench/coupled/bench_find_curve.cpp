@@ -0,0 +1,45 @@
+#include "grpl/pf/coupled/causal_trajectory_generator.h"
+#include "grpl/pf/path/arc_parameterizer.h"
+#include "grpl/pf/profile/trapezoidal.h"
+
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// A single generation step on a path of N curves, with the trajectory near the end of the path. The
+// generator searches the curves linearly on every step (find_curve), so the cost of a step grows with the
+// length of the path.
+static void BM_CDT_FindCurve(benchmark::State &state) {
+  size_t n = static_cast<size_t>(state.range(0));
+
+  // Straight 1m arcs, end to end.
+  std::vector<path::arc_parameterizer::curve_t> curves;
+  for (size_t i = 0; i < n; i++) {
+    double x = static_cast<double>(i);
+    curves.emplace_back(Eigen::Vector2d{x, 0}, Eigen::Vector2d{x + 0.5, 0}, Eigen::Vector2d{x + 1, 0}, 0, 0);
+  }
+
+  double                 G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  profile::trapezoidal                       profile;
+  profile::profile::context                  ctx = profile.get_context();
+  const coupled::causal_trajectory_generator gen{};
+
+  coupled::state last;
+  last.kinematics[POSITION] = n - 0.5;
+  last.kinematics[VELOCITY] = 1;
+
+  for (auto _ : state) {
+    coupled::state next = gen.generate(chassis, curves.begin(), curves.end(), profile, ctx, last, 0.01);
+    benchmark::DoNotOptimize(next);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_CDT_FindCurve)->RangeMultiplier(4)->Range(1, 4096)->Complexity(benchmark::oN);
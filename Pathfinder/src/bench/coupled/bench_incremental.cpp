@@ -0,0 +1,84 @@
+#include "grpl/pf/coupled/incremental_velocity_plan.h"
+#include "grpl/pf/coupled/noncausal_trajectory_generator.h"
+#include "grpl/pf/path/incremental_path.h"
+
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Editing a single waypoint of a 20 waypoint path, as when dragging a waypoint in a path editor. The
+// argument is the index of the moved waypoint: the closer to the end of the path, the less is replanned.
+
+using hermite_t = path::hermite_quintic;
+
+static std::vector<hermite_t::waypoint> bench_waypoints() {
+  std::vector<hermite_t::waypoint> wps;
+  for (int i = 0; i < 20; i++) wps.push_back(hermite_t::waypoint{{2.0 * i, i % 2}, {3, 0}, {0, 0}});
+  return wps;
+}
+
+static void BM_Replan_Full(benchmark::State &state) {
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.01);
+
+  std::vector<hermite_t::waypoint>              wps = bench_waypoints();
+  std::vector<hermite_t>                        hermites;
+  std::vector<path::arc_parameterizer::curve_t> curves;
+  std::vector<coupled::state>                   states(65536);
+  size_t                                        idx = static_cast<size_t>(state.range(0));
+
+  int flip = 0;
+  for (auto _ : state) {
+    wps[idx].position.y() += (flip++ % 2) ? 0.1 : -0.1;
+
+    hermites.clear();
+    curves.clear();
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+    size_t count = gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size());
+    benchmark::DoNotOptimize(count);
+  }
+}
+
+static void BM_Replan_Incremental(benchmark::State &state) {
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  std::vector<hermite_t::waypoint>     wps = bench_waypoints();
+  path::incremental_path<hermite_t>    path(param);
+  coupled::incremental_velocity_plan<> plan(chassis, 0.01);
+  size_t                               idx = static_cast<size_t>(state.range(0));
+
+  path.set_waypoints(wps.begin(), wps.end());
+  plan.update(path.begin(), path.end(), path.update());
+
+  int    flip         = 0;
+  size_t recalculated = 0;
+  for (auto _ : state) {
+    wps[idx].position.y() += (flip++ % 2) ? 0.1 : -0.1;
+    path.set_waypoint(idx, wps[idx]);
+
+    double from = path.update();
+    recalculated += plan.update(path.begin(), path.end(), from);
+  }
+
+  state.counters["Recalculated"] = benchmark::Counter(recalculated, benchmark::Counter::kAvgIterations);
+  state.counters["States"]       = plan.size();
+}
+
+BENCHMARK(BM_Replan_Full)->Arg(2)->Arg(10)->Arg(17)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Replan_Incremental)->Arg(2)->Arg(10)->Arg(17)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,135 @@
+#include "grpl/pf/coupled/noncausal_trajectory_generator.h"
+#include "grpl/pf/path/hermite.h"
+#include "grpl/pf/path/arc_parameterizer.h"
+
+#include "bench_util.h"
+
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Offline counterpart to BM_CDT_Full: the trajectory is generated once up front, at the given sample
+// distance (in mm), and then split per state.
+static void BM_NCDT_Full(benchmark::State &state) {
+  using hermite_t = path::hermite_quintic;
+
+  hermite_t::waypoint start{{2, 2}, {5, 0}, {0, 0}}, end{{5, 5}, {5, 5}, {0, 0}};
+  hermite_t           hermite(start, end);
+
+  double G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis    chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  int    num_iter   = 0;
+  int    num_gens   = 0;
+  int    num_curves = 0;
+  double realtime   = 0;
+
+  double sample_distance = static_cast<double>(state.range(0)) / 1000.0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    // Setup
+    // Param
+    path::arc_parameterizer param;
+    param.configure(0.01, 0.01);
+    // Curves Buffer
+    std::vector<path::arc_parameterizer::curve_t> curves;
+    curves.reserve(1024);
+    // Coupled
+    coupled::noncausal_trajectory_generator gen;
+    gen.configure(sample_distance);
+    std::vector<coupled::state> states(8192);
+    state.ResumeTiming();
+
+    // Benchmark Start
+    param.parameterize(hermite, std::back_inserter(curves), curves.max_size());
+    num_curves += curves.size();
+
+    size_t count = gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size());
+    for (size_t i = 0; i < count; i++) {
+      std::pair<coupled::wheel_state, coupled::wheel_state> split = chassis.split(states[i]);
+      benchmark::DoNotOptimize(split);
+    }
+    num_gens += count;
+    if (count > 0) realtime += states[count - 1].time;
+    num_iter++;
+  }
+
+  state.counters["NumStates"]  = num_gens / num_iter;
+  state.counters["NumCurves"]  = num_curves / num_iter;
+  state.counters["SampleDs"]   = sample_distance;
+  state.counters["MPExecTime"] = realtime / num_iter;
+}
+
+BENCHMARK(BM_NCDT_Full)->Arg(100)->Arg(10)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// The whole offline pipeline, from waypoints to a split trajectory at 10mm samples, on a synthetic path
+// of range(0) waypoints. Registered twice, as Complexity() fits a single N per benchmark: against the
+// number of waypoints, and against the number of curves.
+static void ncdt_full_path(benchmark::State &state, bool by_curves) {
+  using hermite_t = path::hermite_quintic;
+
+  benchutil::path_spec spec;
+  spec.waypoints = static_cast<size_t>(state.range(0));
+
+  std::vector<hermite_t::waypoint> wps = benchutil::synthetic_path(spec);
+
+  double G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  coupled::chassis    chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.01);
+
+  std::vector<hermite_t> hermites;
+  hermites.reserve(wps.size());
+  std::vector<path::arc_parameterizer::curve_t> curves;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             wps.size());
+  curves.reserve(param.curve_count(hermites.begin(), hermites.end()));  // No reallocs during timing
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.capacity());
+  std::vector<coupled::state> states(gen.state_count(curves.begin(), curves.end()));
+
+  size_t count = 0;
+  for (auto _ : state) {
+    hermites.clear();
+    curves.clear();
+
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.capacity());
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.capacity());
+
+    count = gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size());
+    for (size_t i = 0; i < count; i++) {
+      std::pair<coupled::wheel_state, coupled::wheel_state> split = chassis.split(states[i]);
+      benchmark::DoNotOptimize(split);
+    }
+  }
+
+  state.counters["NumWaypoints"] = static_cast<double>(wps.size());
+  state.counters["NumCurves"]    = static_cast<double>(curves.size());
+  state.counters["NumStates"]    = static_cast<double>(count);
+  state.counters["MPExecTime"]   = count > 0 ? states[count - 1].time : 0;
+  state.SetComplexityN(by_curves ? static_cast<int64_t>(curves.size()) : state.range(0));
+}
+
+static void BM_NCDT_FullPath_ByWaypoints(benchmark::State &state) {
+  ncdt_full_path(state, false);
+}
+
+static void BM_NCDT_FullPath_ByCurves(benchmark::State &state) {
+  ncdt_full_path(state, true);
+}
+
+BENCHMARK(BM_NCDT_FullPath_ByWaypoints)
+    ->Arg(2)->Arg(10)->Arg(100)->Arg(1000)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NCDT_FullPath_ByCurves)
+    ->Arg(2)->Arg(10)->Arg(100)->Arg(1000)->Complexity()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,102 @@
+#include "grpl/pf/coupled/causal_trajectory_generator.h"
+#include "grpl/pf/coupled/realtime_trajectory_generator.h"
+#include "grpl/pf/path/arc_parameterizer.h"
+#include "grpl/pf/path/hermite.h"
+#include "grpl/pf/profile/trapezoidal.h"
+
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Latency of a single generate() call, halfway along a path of a growing number of curves. The causal
+// generator searches the curves linearly, the real-time generator by binary search.
+
+using hermite_t = path::hermite_quintic;
+
+static std::vector<path::arc_parameterizer::curve_t> bench_curves(int waypoints) {
+  std::vector<hermite_t::waypoint> wps;
+  for (int i = 0; i < waypoints; i++) wps.push_back(hermite_t::waypoint{{2.0 * i, i % 2}, {3, 0}, {0, 0}});
+
+  std::vector<hermite_t> hermites;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             hermites.max_size());
+
+  path::arc_parameterizer                       param;
+  std::vector<path::arc_parameterizer::curve_t> curves;
+  param.configure(0.01, 0.01);
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+  return curves;
+}
+
+static coupled::state bench_start(double length) {
+  coupled::state st;
+  st.time       = 1;
+  st.kinematics = coupled::kinematic_state{length / 2, 1, 0};
+  return st;
+}
+
+static void BM_Generate_Causal(benchmark::State &state) {
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::arc_parameterizer::curve_t> curves = bench_curves(static_cast<int>(state.range(0)));
+  const coupled::causal_trajectory_generator    gen{};
+  const profile::trapezoidal                    profile;
+  profile::trapezoidal::context                 ctx;
+
+  double         length = 0;
+  for (auto &c : curves) length += c.length();
+  coupled::state last   = bench_start(length);
+
+  for (auto _ : state) {
+    coupled::state st = gen.generate(chassis, curves.begin(), curves.end(), profile, ctx, last, 1.01);
+    benchmark::DoNotOptimize(st);
+  }
+  state.SetComplexityN(curves.size());
+}
+
+static void BM_Generate_Realtime(benchmark::State &state) {
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::arc_parameterizer::curve_t> curves = bench_curves(static_cast<int>(state.range(0)));
+  const coupled::realtime_trajectory_generator  gen(curves.begin(), curves.end());
+  const profile::trapezoidal                    profile;
+  profile::trapezoidal::context                 ctx;
+
+  coupled::state last = bench_start(gen.length());
+
+  for (auto _ : state) {
+    coupled::state st = gen.generate(chassis, profile, ctx, last, 1.01);
+    benchmark::DoNotOptimize(st);
+  }
+  state.SetComplexityN(curves.size());
+}
+
+// A missed cycle (dt = 100ms) in the profile, with and without a maximum slice count.
+static void BM_Generate_MissedCycle(benchmark::State &state) {
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::arc_parameterizer::curve_t> curves = bench_curves(8);
+  const coupled::realtime_trajectory_generator  gen(curves.begin(), curves.end());
+  profile::trapezoidal                          profile;
+  profile::trapezoidal::context                 ctx;
+  profile.set_max_slices(static_cast<int>(state.range(0)));
+
+  coupled::state last = bench_start(gen.length());
+
+  for (auto _ : state) {
+    coupled::state st = gen.generate(chassis, profile, ctx, last, 1.1);
+    benchmark::DoNotOptimize(st);
+  }
+}
+
+BENCHMARK(BM_Generate_Causal)->RangeMultiplier(2)->Range(2, 64)->Complexity();
+BENCHMARK(BM_Generate_Realtime)->RangeMultiplier(2)->Range(2, 64)->Complexity();
+BENCHMARK(BM_Generate_MissedCycle)->Arg(0)->Arg(10);
@@ -0,0 +1,48 @@
+#include "grpl/pf/coupled/tangent_optimizer.h"
+#include "grpl/pf/transmission/current_limit.h"
+
+#include <array>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Full optimization of a 5 waypoint path with the given number of worker threads.
+static void BM_TangentOptimizer(benchmark::State &state) {
+  using hermite_t   = path::hermite_quintic;
+  using limited_t   = transmission::current_limited<transmission::dc_motor>;
+  using chassis_t   = coupled::basic_chassis<limited_t, limited_t>;
+  using optimizer_t = coupled::tangent_optimizer<hermite_t, chassis_t>;
+
+  double G = 12.75;
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * G};
+  limited_t              limited{dualCIM, 120};
+  chassis_t              chassis{limited, limited, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.05, 0.05);
+
+  std::array<hermite_t::waypoint, 5> initial{
+      hermite_t::waypoint{{0, 0}, {1, 0}, {0, 0}}, hermite_t::waypoint{{2, 1}, {0, 1}, {0, 0}},
+      hermite_t::waypoint{{4, 4}, {0, 1}, {0, 0}}, hermite_t::waypoint{{6, 5}, {1, 0}, {0, 0}},
+      hermite_t::waypoint{{8, 4}, {1, -1}, {0, 0}}};
+
+  util::thread_pool pool(static_cast<size_t>(state.range(0)));
+  optimizer_t       optimizer(pool, chassis, param, 8, 1024, 4096);
+  optimizer.configure(0.05);
+
+  optimizer_t::result res;
+  for (auto _ : state) {
+    std::array<hermite_t::waypoint, 5> wps = initial;
+    res                                    = optimizer.optimize(wps.data(), wps.size());
+    benchmark::DoNotOptimize(wps.data());
+  }
+
+  state.counters["Threads"]     = pool.size();
+  state.counters["Evaluations"] = res.evaluations;
+  state.counters["InitialTime"] = res.initial_time;
+  state.counters["Time"]        = res.time;
+}
+
+BENCHMARK(BM_TangentOptimizer)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,36 @@
+#include "grpl/pf/coupled/trajectory.h"
+
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Sample a trajectory of N states at 1kHz, with a constant-acceleration straight line.
+static void BM_Trajectory_Sample(benchmark::State &state) {
+  size_t N = static_cast<size_t>(state.range(0));
+
+  std::vector<coupled::state> states(N);
+  for (size_t i = 0; i < N; i++) {
+    double t                          = static_cast<double>(i) * 0.01;
+    states[i].time                     = t;
+    states[i].kinematics[POSITION]     = 0.5 * t * t;
+    states[i].kinematics[VELOCITY]     = t;
+    states[i].kinematics[ACCELERATION] = 1;
+    states[i].config                   = coupled::configuration_state{0.5 * t * t, 0, 0};
+  }
+
+  coupled::trajectory traj(states.begin(), states.end());
+
+  double t = 0;
+  for (auto _ : state) {
+    t += 0.001;
+    if (t > traj.end_time()) t = 0;
+    coupled::state st = traj.sample(t);
+    benchmark::DoNotOptimize(st);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_Trajectory_Sample)->RangeMultiplier(8)->Range(8, 32768)->Complexity();
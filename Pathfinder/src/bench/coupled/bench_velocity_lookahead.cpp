@@ -0,0 +1,75 @@
+#include "grpl/pf/coupled/causal_trajectory_generator.h"
+#include "grpl/pf/coupled/velocity_lookahead.h"
+#include "grpl/pf/path/arc_parameterizer.h"
+#include "grpl/pf/path/hermite.h"
+#include "grpl/pf/profile/trapezoidal.h"
+
+#include <vector>
+
+using namespace grpl::pf;
+
+#include <benchmark/benchmark.h>
+
+// Cost of building the lookahead table once per path (growing with the path), and of a single generate()
+// call with and without the lookahead, which should remain constant.
+
+using hermite_t = path::hermite_quintic;
+
+static std::vector<path::arc_parameterizer::curve_t> bench_curves(int waypoints) {
+  std::vector<hermite_t::waypoint> wps;
+  for (int i = 0; i < waypoints; i++) wps.push_back(hermite_t::waypoint{{2.0 * i, i % 2}, {3, 0}, {0, 0}});
+
+  std::vector<hermite_t> hermites;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             hermites.max_size());
+
+  path::arc_parameterizer                       param;
+  std::vector<path::arc_parameterizer::curve_t> curves;
+  param.configure(0.01, 0.01);
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+  return curves;
+}
+
+static void BM_Lookahead_Build(benchmark::State &state) {
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::arc_parameterizer::curve_t> curves = bench_curves(static_cast<int>(state.range(0)));
+  coupled::velocity_lookahead                   lookahead(0.01);
+
+  for (auto _ : state) {
+    lookahead.build(chassis, curves.begin(), curves.end());
+    benchmark::ClobberMemory();
+  }
+  state.SetComplexityN(static_cast<int64_t>(lookahead.size()));
+}
+
+static void BM_Lookahead_Generate(benchmark::State &state) {
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::arc_parameterizer::curve_t> curves = bench_curves(4);
+  const coupled::causal_trajectory_generator    gen{};
+  const profile::trapezoidal                    profile;
+  profile::trapezoidal::context                 ctx;
+  coupled::velocity_lookahead                   lookahead(0.01);
+  lookahead.build(chassis, curves.begin(), curves.end());
+
+  coupled::state last;
+  last.time       = 1;
+  last.kinematics = coupled::kinematic_state{lookahead.length() / 2, 1, 0};
+
+  bool use_lookahead = state.range(0) != 0;
+  for (auto _ : state) {
+    coupled::state st =
+        use_lookahead
+            ? gen.generate(chassis, curves.begin(), curves.end(), profile, ctx, lookahead, last, 1.01)
+            : gen.generate(chassis, curves.begin(), curves.end(), profile, ctx, last, 1.01);
+    benchmark::DoNotOptimize(st);
+  }
+}
+
+BENCHMARK(BM_Lookahead_Build)->RangeMultiplier(2)->Range(2, 32)->Complexity();
+BENCHMARK(BM_Lookahead_Generate)->Arg(0)->Arg(1);
@@ -0,0 +1,74 @@
+#include "grpl/pf/path/arc.h"
+#include "grpl/pf/path/augmented_arc.h"
+
+using namespace grpl::pf;
+using namespace grpl::pf::path;
+
+#include <benchmark/benchmark.h>
+
+// An arc of radius 2 through a quarter circle, and a straight line (colinear points).
+static const arc2d::vector_t start{0, 0}, mid{2 - sqrt(2.0), sqrt(2.0)}, end{2, 2}, line_end{4, 4};
+
+static void BM_Arc_Construct(benchmark::State &state) {
+  arc2d::vector_t s = start;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    arc2d arc{s, mid, end};
+    benchmark::DoNotOptimize(arc);
+  }
+}
+
+static void BM_Arc_ConstructLine(benchmark::State &state) {
+  arc2d::vector_t s = start;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    arc2d arc{s, end, line_end};
+    benchmark::DoNotOptimize(arc);
+  }
+}
+
+// As constructed by the arc parameterizer for each arc of a path.
+static void BM_Arc_ConstructAugmented(benchmark::State &state) {
+  arc2d::vector_t s = start;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    augmented_arc2d arc{s, mid, end, 0.4, 0.6};
+    benchmark::DoNotOptimize(arc);
+  }
+}
+
+// Evaluate a curve over its length, as the trajectory generator does on each step.
+template <typename eval_t>
+static void arc_eval(benchmark::State &state, const curve<2> &arc, eval_t eval) {
+  double s = 0, step = arc.length() / 1000;
+  for (auto _ : state) {
+    s = s >= arc.length() ? 0 : s + step;
+    benchmark::DoNotOptimize(eval(arc, s));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Arc_Position(benchmark::State &state) {
+  arc_eval(state, arc2d{start, mid, end}, [](const curve<2> &c, double s) { return c.position(s); });
+}
+
+static void BM_Arc_PositionLine(benchmark::State &state) {
+  arc_eval(state, arc2d{start, end, line_end}, [](const curve<2> &c, double s) { return c.position(s); });
+}
+
+static void BM_Arc_Derivative(benchmark::State &state) {
+  arc_eval(state, arc2d{start, mid, end}, [](const curve<2> &c, double s) { return c.derivative(s); });
+}
+
+static void BM_Arc_CurvatureAugmented(benchmark::State &state) {
+  arc_eval(state, augmented_arc2d{start, mid, end, 0.4, 0.6},
+           [](const curve<2> &c, double s) { return c.curvature(s); });
+}
+
+BENCHMARK(BM_Arc_Construct);
+BENCHMARK(BM_Arc_ConstructLine);
+BENCHMARK(BM_Arc_ConstructAugmented);
+BENCHMARK(BM_Arc_Position);
+BENCHMARK(BM_Arc_PositionLine);
+BENCHMARK(BM_Arc_Derivative);
+BENCHMARK(BM_Arc_CurvatureAugmented);
@@ -1,6 +1,9 @@
 #include "grpl/pf/path/arc_parameterizer.h"
 #include "grpl/pf/path/hermite.h"
 
+#include "bench_util.h"
+
+#include <cmath>
 #include <vector>
 
 using namespace grpl::pf;
@@ -34,4 +37,73 @@ static void BM_ArcParamHermite(benchmark::State &state) {
   state.SetComplexityN(state.range(0));
 }
 
-BENCHMARK(BM_ArcParamHermite)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Complexity()->Unit(benchmark::kMillisecond);
\ No newline at end of file
+BENCHMARK(BM_ArcParamHermite)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Complexity()->Unit(benchmark::kMillisecond);
+
+// Parameterize a whole synthetic path of range(0) waypoints, with turns of up to range(1) milliradians.
+// Registered twice, as Complexity() fits a single N per benchmark: against the number of waypoints, and
+// against the number of curves produced.
+static void arc_param_path(benchmark::State &state, bool by_curves) {
+  using hermite_t = path::hermite_quintic;
+
+  benchutil::path_spec spec;
+  spec.waypoints = static_cast<size_t>(state.range(0));
+  spec.max_turn  = static_cast<double>(state.range(1)) / 1000.0;
+
+  std::vector<hermite_t::waypoint> wps = benchutil::synthetic_path(spec);
+  std::vector<hermite_t>           hermites;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             wps.size());
+
+  arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  std::vector<arc_parameterizer::curve_t> curves;
+  curves.reserve(param.curve_count(hermites.begin(), hermites.end()));  // No reallocs during timing
+
+  for (auto _ : state) {
+    curves.clear();
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.capacity());
+    benchmark::DoNotOptimize(curves.data());
+  }
+
+  // Length-weighted mean absolute curvature of the path, as realised by the splines.
+  double length = 0, curvature = 0;
+  for (auto &curve : curves) {
+    length += curve.length();
+    curvature += fabs(curve.curvature(curve.length() / 2.0)) * curve.length();
+  }
+
+  state.counters["NumWaypoints"]  = static_cast<double>(wps.size());
+  state.counters["NumCurves"]     = static_cast<double>(curves.size());
+  state.counters["MeanCurvature"] = curvature / length;
+  state.SetItemsProcessed(state.iterations() * curves.size());
+  state.SetComplexityN(by_curves ? static_cast<int64_t>(curves.size()) : state.range(0));
+}
+
+static void BM_ArcParamPath_ByWaypoints(benchmark::State &state) {
+  arc_param_path(state, false);
+}
+
+static void BM_ArcParamPath_ByCurves(benchmark::State &state) {
+  arc_param_path(state, true);
+}
+
+// The same path, with increasingly tight turns.
+static void BM_ArcParamPath_Curvature(benchmark::State &state) {
+  arc_param_path(state, true);
+}
+
+// Waypoint counts from 2 to 1000, with turns of up to 0.5 rad.
+static void path_args(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"waypoints", "turn_mrad"});
+  for (int64_t n : {2, 10, 100, 1000}) b->Args({n, 500});
+}
+
+BENCHMARK(BM_ArcParamPath_ByWaypoints)->Apply(path_args)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ArcParamPath_ByCurves)->Apply(path_args)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ArcParamPath_Curvature)
+    ->ArgNames({"waypoints", "turn_mrad"})
+    ->Args({100, 100})
+    ->Args({100, 1000})
+    ->Args({100, 2000})
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,105 @@
+#include "grpl/pf/path/hermite.h"
+
+using namespace grpl::pf;
+using namespace grpl::pf::path;
+
+#include <benchmark/benchmark.h>
+
+static hermite_cubic make_cubic() {
+  return hermite_cubic{{{2, 2}, {5, 0}}, {{5, 5}, {5, 5}}};
+}
+
+static hermite_quintic make_quintic() {
+  return hermite_quintic{{{2, 2}, {5, 0}, {0, 0}}, {{5, 5}, {5, 5}, {0, 0}}};
+}
+
+// Evaluate a spline over t in [0, 1], as the arc parameterizer does when sampling a spline.
+template <typename hermite_t, typename eval_t>
+static void hermite_eval(benchmark::State &state, hermite_t hermite, eval_t eval) {
+  double t = 0;
+  for (auto _ : state) {
+    t = t >= 1 ? 0 : t + 0.001;
+    benchmark::DoNotOptimize(eval(hermite, t));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Hermite_CubicConstruct(benchmark::State &state) {
+  hermite_cubic::waypoint start{{2, 2}, {5, 0}}, end{{5, 5}, {5, 5}};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(start);
+    hermite_cubic hermite{start, end};
+    benchmark::DoNotOptimize(hermite);
+  }
+}
+
+static void BM_Hermite_QuinticConstruct(benchmark::State &state) {
+  hermite_quintic::waypoint start{{2, 2}, {5, 0}, {0, 0}}, end{{5, 5}, {5, 5}, {0, 0}};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(start);
+    hermite_quintic hermite{start, end};
+    benchmark::DoNotOptimize(hermite);
+  }
+}
+
+static void BM_Hermite_CubicPosition(benchmark::State &state) {
+  hermite_eval(state, make_cubic(), [](hermite_cubic &h, double t) { return h.position(t); });
+}
+
+static void BM_Hermite_CubicDerivative(benchmark::State &state) {
+  hermite_eval(state, make_cubic(), [](hermite_cubic &h, double t) { return h.derivative(t); });
+}
+
+static void BM_Hermite_CubicCurvature(benchmark::State &state) {
+  hermite_eval(state, make_cubic(), [](hermite_cubic &h, double t) { return h.curvature(t); });
+}
+
+static void BM_Hermite_QuinticPosition(benchmark::State &state) {
+  hermite_eval(state, make_quintic(), [](hermite_quintic &h, double t) { return h.position(t); });
+}
+
+static void BM_Hermite_QuinticDerivative(benchmark::State &state) {
+  hermite_eval(state, make_quintic(), [](hermite_quintic &h, double t) { return h.derivative(t); });
+}
+
+static void BM_Hermite_QuinticCurvature(benchmark::State &state) {
+  hermite_eval(state, make_quintic(), [](hermite_quintic &h, double t) { return h.curvature(t); });
+}
+
+// Through the spline<2> interface, as used by the parameterizer when given splines at runtime.
+static void BM_Hermite_QuinticCurvatureVirtual(benchmark::State &state) {
+  hermite_quintic hermite = make_quintic();
+  spline<2> *     spl     = &hermite;
+  benchmark::DoNotOptimize(spl);
+  hermite_eval(state, spl, [](spline<2> *s, double t) { return s->curvature(t); });
+}
+
+// Generating the splines of a path of N waypoints.
+static void BM_Hermite_FactoryQuintic(benchmark::State &state) {
+  std::vector<hermite_quintic::waypoint> wps;
+  for (int64_t i = 0; i < state.range(0); i++)
+    wps.push_back(hermite_quintic::waypoint{{i, (i % 2) * 2.0}, {5, 0}, {0, 0}});
+
+  std::vector<hermite_quintic> hermites;
+  hermites.reserve(wps.size());
+  for (auto _ : state) {
+    hermites.clear();
+    hermite_factory::generate<hermite_quintic>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.capacity());
+    benchmark::DoNotOptimize(hermites.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_Hermite_CubicConstruct);
+BENCHMARK(BM_Hermite_QuinticConstruct);
+BENCHMARK(BM_Hermite_CubicPosition);
+BENCHMARK(BM_Hermite_CubicDerivative);
+BENCHMARK(BM_Hermite_CubicCurvature);
+BENCHMARK(BM_Hermite_QuinticPosition);
+BENCHMARK(BM_Hermite_QuinticDerivative);
+BENCHMARK(BM_Hermite_QuinticCurvature);
+BENCHMARK(BM_Hermite_QuinticCurvatureVirtual);
+BENCHMARK(BM_Hermite_FactoryQuintic)->RangeMultiplier(8)->Range(2, 1024)->Complexity();
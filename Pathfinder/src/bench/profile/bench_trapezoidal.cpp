@@ -22,4 +22,30 @@ static void BM_Profile_Trapezoidal(benchmark::State &state) {
   state.SetComplexityN(state.range(0));
 }
 
-BENCHMARK(BM_Profile_Trapezoidal)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Complexity()->Unit(benchmark::kMillisecond);
\ No newline at end of file
+BENCHMARK(BM_Profile_Trapezoidal)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Complexity()->Unit(benchmark::kMillisecond);
+// A 100Hz control loop over the whole profile, with each call split into dt / timeslice slices.
+static void BM_Profile_TrapezoidalTimeslice(benchmark::State &state) {
+  const double dt = 0.01;
+
+  trapezoidal pr;
+  pr.apply_limit(1, -3, 3);
+  pr.apply_limit(2, -3, 4);
+  pr.set_goal(5);
+  pr.set_timeslice(dt / static_cast<double>(state.range(0)));
+
+  for (auto _ : state) {
+    ::grpl::pf::profile::state st;
+    for (double t = dt; t < 10; t += dt) {
+      benchmark::DoNotOptimize(st = pr.calculate(st, t));
+    }
+  }
+
+  state.counters["SlicesPerCall"] = static_cast<double>(state.range(0));
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_Profile_TrapezoidalTimeslice)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->Complexity(benchmark::oN)
+    ->Unit(benchmark::kMicrosecond);
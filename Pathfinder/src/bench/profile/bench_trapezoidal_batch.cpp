@@ -0,0 +1,64 @@
+#include <grpl/pf/profile/trapezoidal.h>
+#include <grpl/pf/profile/trapezoidal_batch.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace grpl::pf;
+using namespace grpl::pf::profile;
+
+// N independent profiles, each advanced with its own virtual calculate call.
+static void BM_Profile_TrapezoidalScalarN(benchmark::State &state) {
+  size_t N = static_cast<size_t>(state.range(0));
+
+  std::vector<trapezoidal>                profiles(N);
+  std::vector<::grpl::pf::profile::state> states(N);
+
+  for (size_t i = 0; i < N; i++) {
+    profiles[i].apply_limit(VELOCITY, -3, 3);
+    profiles[i].apply_limit(ACCELERATION, -3, 4);
+    profiles[i].set_goal(5 + 0.001 * i);
+    profiles[i].set_timeslice(0);
+  }
+
+  double t = 0;
+  for (auto _ : state) {
+    t += 0.001;
+    for (size_t i = 0; i < N; i++) {
+      profile::profile &p = profiles[i];
+      states[i]           = p.calculate(states[i], t);
+    }
+    benchmark::DoNotOptimize(states.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+  state.SetComplexityN(state.range(0));
+}
+
+// N independent profiles, advanced together in structure-of-arrays form.
+static void BM_Profile_TrapezoidalBatchN(benchmark::State &state) {
+  size_t N = static_cast<size_t>(state.range(0));
+
+  trapezoidal_batch batch(N);
+  batch.set_timeslice(0);
+
+  for (size_t i = 0; i < N; i++) {
+    batch.apply_limit(i, VELOCITY, -3, 3);
+    batch.apply_limit(i, ACCELERATION, -3, 4);
+    batch.set_goal(i, 5 + 0.001 * i);
+  }
+
+  double t = 0;
+  for (auto _ : state) {
+    t += 0.001;
+    batch.calculate(t);
+    benchmark::DoNotOptimize(batch.position().data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_Profile_TrapezoidalScalarN)->RangeMultiplier(4)->Range(1, 4096)->Complexity();
+BENCHMARK(BM_Profile_TrapezoidalBatchN)->RangeMultiplier(4)->Range(1, 4096)->Complexity();
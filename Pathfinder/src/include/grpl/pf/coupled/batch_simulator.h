@@ -0,0 +1,274 @@
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/transmission/dc.h"
+#include "grpl/pf/util/thread_pool.h"
+#include "wheel_track.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Batched forward simulator of a coupled chassis, used to validate a trajectory against uncertainty in
+     * the parameters of the chassis (Monte Carlo).
+     *
+     * The simulator drives many independent simulated robots, each with its own mass, wheel radius and
+     * battery voltage, with the voltages of a pair of @ref wheel_track (as produced by
+     * @ref basic_chassis::split). Each side is modelled as in @ref basic_chassis: a
+     * @ref transmission::dc_motor accelerating the mass of the chassis through its wheel, such that a robot
+     * with the nominal parameters of the chassis follows the trajectory. The voltage applied to each side
+     * is the voltage of the track, limited to the battery voltage of the robot. Note the voltages of a
+     * track may exceed the nominal voltage of the transmissions, as the limits of the chassis constrain
+     * the mean acceleration of both sides, not each side.
+     *
+     * The state of each robot (position, heading and the velocity of each side) is integrated with RK4,
+     * with a configurable number of steps between each pair of states of the tracks. The distance between
+     * each robot and the centre of the tracks is measured at each state of the tracks.
+     *
+     * The robots are stored in structure-of-arrays form. Robots are simulated in blocks distributed over a
+     * @ref util::thread_pool, with each integration step a single loop over the robots of the block, which
+     * the compiler may vectorize. All storage is allocated on construction; simulating does not allocate.
+     *
+     * @param chassis_type The type of chassis, with @ref transmission::dc_motor transmissions.
+     */
+    template <typename chassis_type = basic_chassis<transmission::dc_motor, transmission::dc_motor>>
+    class batch_simulator {
+     public:
+      using chassis_t   = chassis_type;
+      using array_t     = Eigen::Array<double, Eigen::Dynamic, 1>;
+      using const_map_t = Eigen::Map<const array_t>;
+
+      /**
+       * The uncertain parameters of a single simulated robot.
+       */
+      struct parameters {
+        //! The mass of the chassis, in kilograms.
+        double mass;
+        //! The wheel radius, in metres.
+        double wheel_radius;
+        //! The battery voltage, in Volts. The voltage applied to each side is limited to this voltage.
+        double battery_voltage;
+      };
+
+      /**
+       * Create a simulator.
+       *
+       * @param chassis   The nominal chassis, held internally as a reference. The track radius and the
+       *                  transmissions of the chassis are shared by all robots.
+       * @param capacity  The maximum number of robots simulated at once.
+       */
+      batch_simulator(const chassis_t &chassis, size_t capacity)
+          : _chassis(chassis),
+            _capacity(capacity),
+            _x(capacity, 0),
+            _y(capacity, 0),
+            _heading(capacity, 0),
+            _vel_left(capacity, 0),
+            _vel_right(capacity, 0),
+            _max_error(capacity, 0),
+            _gain_left(capacity, 0),
+            _gain_right(capacity, 0),
+            _emf_left(capacity, 0),
+            _emf_right(capacity, 0),
+            _battery(capacity, 0) {}
+
+      /**
+       * @return The maximum number of robots simulated at once.
+       */
+      size_t capacity() const { return _capacity; }
+
+      /**
+       * @return The number of robots, as set by @ref set_parameters.
+       */
+      size_t size() const { return _size; }
+
+      /**
+       * @return The parameters of the nominal chassis, with the battery at the nominal voltage of the
+       *         transmissions.
+       */
+      parameters nominal() const {
+        return parameters{_chassis.mass(), _chassis.wheel_radius(),
+                          _chassis.transmission_left().nominal_voltage()};
+      }
+
+      /**
+       * Set the number of RK4 steps taken between each pair of states of the tracks.
+       *
+       * @param substeps The number of steps, at least 1.
+       */
+      void set_substeps(size_t substeps) { _substeps = std::max<size_t>(substeps, 1); }
+
+      /**
+       * @return The number of RK4 steps taken between each pair of states of the tracks.
+       */
+      size_t get_substeps() const { return _substeps; }
+
+      /**
+       * Set the parameters of each robot.
+       *
+       * @param params_begin  Iterator to the parameters of the first robot.
+       * @param params_end    Iterator to the end of the parameters.
+       * @return              The number of robots. If there are more parameters than the capacity of the
+       *                      simulator, only the first are used.
+       */
+      template <typename iterator_params_t>
+      size_t set_parameters(const iterator_params_t params_begin, const iterator_params_t params_end) {
+        const auto &left = _chassis.transmission_left(), &right = _chassis.transmission_right();
+
+        size_t n = 0;
+        for (iterator_params_t it = params_begin; it != params_end && n < _capacity; it++, n++) {
+          const parameters &p = *it;
+          // dv/dt = (V - kv*v/r) / (R * kt * m * r). See basic_chassis::split
+          _gain_left[n]  = 1.0 / (left.internal_resistance() * left.kt() * p.mass * p.wheel_radius);
+          _gain_right[n] = 1.0 / (right.internal_resistance() * right.kt() * p.mass * p.wheel_radius);
+          _emf_left[n]   = left.kv() / p.wheel_radius;
+          _emf_right[n]  = right.kv() / p.wheel_radius;
+          _battery[n]    = std::abs(p.battery_voltage);
+        }
+        _size = n;
+        return n;
+      }
+
+      /**
+       * Simulate all robots following a trajectory, from its first state to its last.
+       *
+       * All robots start at the first state of the tracks. After simulating, the final state and the
+       * maximum error of each robot are available through the column accessors.
+       *
+       * @param pool  The thread pool to simulate with.
+       * @param left  The left wheel track of the trajectory.
+       * @param right The right wheel track of the trajectory, of the same size as the left.
+       */
+      void simulate(util::thread_pool &pool, const wheel_track &left, const wheel_track &right) {
+        size_t blocks = (_size + block_size - 1) / block_size;
+        auto   fn     = [&](size_t block, size_t) {
+          size_t first = block * block_size;
+          simulate_block(left, right, first, std::min(_size, first + block_size));
+        };
+        pool.parallel_for(blocks, fn);
+      }
+
+      //! @return The final x position of each robot, in metres.
+      const_map_t x() const { return const_map_t(_x.data(), _size); }
+      //! @return The final y position of each robot, in metres.
+      const_map_t y() const { return const_map_t(_y.data(), _size); }
+      //! @return The final heading of each robot, in radians.
+      const_map_t heading() const { return const_map_t(_heading.data(), _size); }
+      //! @return The final velocity of the left side of each robot, in metres per second (ms^-1).
+      const_map_t velocity_left() const { return const_map_t(_vel_left.data(), _size); }
+      //! @return The final velocity of the right side of each robot, in metres per second (ms^-1).
+      const_map_t velocity_right() const { return const_map_t(_vel_right.data(), _size); }
+      //! @return The maximum distance between each robot and the centre of the tracks, in metres.
+      const_map_t max_error() const { return const_map_t(_max_error.data(), _size); }
+
+     private:
+      // The number of robots simulated together. The columns of a block remain in cache for the whole
+      // trajectory.
+      static constexpr size_t block_size = 64;
+
+      void simulate_block(const wheel_track &left, const wheel_track &right, size_t first, size_t last) {
+        size_t count = std::min(left.size(), right.size());
+        if (count == 0 || first >= last) return;
+
+        // The initial state is the centre of the tracks. The left wheel is offset by (0, r) from the
+        // centre, rotated by the heading. See basic_chassis::split
+        double cx = (left.x()[0] + right.x()[0]) / 2, cy = (left.y()[0] + right.y()[0]) / 2;
+        double heading = atan2(-(left.x()[0] - right.x()[0]), left.y()[0] - right.y()[0]);
+
+        for (size_t i = first; i < last; i++) {
+          _x[i] = cx;
+          _y[i] = cy;
+
+          _heading[i]   = heading;
+          _vel_left[i]  = left.velocity()[0];
+          _vel_right[i] = right.velocity()[0];
+          _max_error[i] = 0;
+        }
+
+        double inv_track = 1.0 / (2 * _chassis.track_radius());
+        size_t n         = last - first;
+
+        for (size_t s = 1; s < count; s++) {
+          // The acceleration of a state is the acceleration over the interval leading to it, so the voltage
+          // of the state is held over that interval.
+          double dt = (left.time()[s] - left.time()[s - 1]) / _substeps;
+
+          for (size_t k = 0; k < _substeps; k++)
+            rk4_step(&_x[first], &_y[first], &_heading[first], &_vel_left[first], &_vel_right[first],
+                     &_gain_left[first], &_gain_right[first], &_emf_left[first], &_emf_right[first],
+                     &_battery[first], left.voltage()[s], right.voltage()[s], inv_track, dt, n);
+
+          cx = (left.x()[s] + right.x()[s]) / 2;
+          cy = (left.y()[s] + right.y()[s]) / 2;
+          measure_error(&_x[first], &_y[first], &_max_error[first], cx, cy, n);
+        }
+      }
+
+      // A single RK4 step of each robot. These take the columns as restrict parameters (not members) so the
+      // compiler knows the columns do not alias, allowing it to vectorize the loop over robots.
+      static void rk4_step(double *__restrict x, double *__restrict y, double *__restrict heading,
+                           double *__restrict vel_left, double *__restrict vel_right,
+                           const double *__restrict gain_left, const double *__restrict gain_right,
+                           const double *__restrict emf_left, const double *__restrict emf_right,
+                           const double *__restrict battery, const double volts_left,
+                           const double volts_right, const double inv_track, const double dt,
+                           const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+          double vl = std::max(-battery[i], std::min(battery[i], volts_left));
+          double vr = std::max(-battery[i], std::min(battery[i], volts_right));
+
+          double gl = gain_left[i], gr = gain_right[i], el = emf_left[i], er = emf_right[i];
+          double th = heading[i], ul = vel_left[i], ur = vel_right[i];
+
+          // State derivative: position from the linear velocity, heading from the angular velocity and
+          // each side from its transmission. k1..k4 are the RK4 stages.
+          double k1_l = gl * (vl - el * ul), k1_r = gr * (vr - er * ur);
+          double k1_v = (ul + ur) / 2, k1_t = (ur - ul) * inv_track;
+
+          double ul2 = ul + 0.5 * dt * k1_l, ur2 = ur + 0.5 * dt * k1_r, th2 = th + 0.5 * dt * k1_t;
+          double k2_l = gl * (vl - el * ul2), k2_r = gr * (vr - er * ur2);
+          double k2_v = (ul2 + ur2) / 2, k2_t = (ur2 - ul2) * inv_track;
+
+          double ul3 = ul + 0.5 * dt * k2_l, ur3 = ur + 0.5 * dt * k2_r, th3 = th + 0.5 * dt * k2_t;
+          double k3_l = gl * (vl - el * ul3), k3_r = gr * (vr - er * ur3);
+          double k3_v = (ul3 + ur3) / 2, k3_t = (ur3 - ul3) * inv_track;
+
+          double ul4 = ul + dt * k3_l, ur4 = ur + dt * k3_r, th4 = th + dt * k3_t;
+          double k4_l = gl * (vl - el * ul4), k4_r = gr * (vr - er * ur4);
+          double k4_v = (ul4 + ur4) / 2, k4_t = (ur4 - ul4) * inv_track;
+
+          double w = dt / 6;
+          x[i] += w * (k1_v * cos(th) + 2 * k2_v * cos(th2) + 2 * k3_v * cos(th3) + k4_v * cos(th4));
+          y[i] += w * (k1_v * sin(th) + 2 * k2_v * sin(th2) + 2 * k3_v * sin(th3) + k4_v * sin(th4));
+
+          heading[i]   = th + w * (k1_t + 2 * k2_t + 2 * k3_t + k4_t);
+          vel_left[i]  = ul + w * (k1_l + 2 * k2_l + 2 * k3_l + k4_l);
+          vel_right[i] = ur + w * (k1_r + 2 * k2_r + 2 * k3_r + k4_r);
+        }
+      }
+
+      static void measure_error(const double *__restrict x, const double *__restrict y,
+                                double *__restrict max_error, const double cx, const double cy,
+                                const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+          double dx = x[i] - cx, dy = y[i] - cy;
+          max_error[i] = std::max(max_error[i], std::sqrt(dx * dx + dy * dy));
+        }
+      }
+
+      using column_t = std::vector<double>;
+
+      const chassis_t &_chassis;
+      size_t           _capacity, _size = 0, _substeps = 4;
+      // Robot state, followed by per-robot constants derived from the parameters.
+      column_t _x, _y, _heading, _vel_left, _vel_right, _max_error;
+      column_t _gain_left, _gain_right, _emf_left, _emf_right, _battery;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
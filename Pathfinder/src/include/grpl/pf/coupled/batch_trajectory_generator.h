@@ -0,0 +1,180 @@
+#pragma once
+
+#include "causal_trajectory_generator.h"
+#include "chassis.h"
+#include "grpl/pf/path/arc_parameterizer.h"
+#include "grpl/pf/path/hermite.h"
+#include "grpl/pf/profile/trapezoidal.h"
+#include "grpl/pf/util/thread_pool.h"
+#include "state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Batch trajectory generator, running the full generation pipeline for many paths concurrently.
+     *
+     * For each path request, the batch generator runs the same pipeline as would be used for a single path:
+     * @ref grpl::pf::path::hermite_factory::generate, @ref grpl::pf::path::arc_parameterizer and
+     * @ref causal_trajectory_generator, splitting each state with the chassis to find the current drawn. The
+     * requests are distributed over the workers of a @ref grpl::pf::util::thread_pool.
+     *
+     * This is intended for planners evaluating many candidate paths, where only summary metrics (total time,
+     * peak current) are required for most candidates. Full trajectories may also be written out per-request.
+     *
+     * The profile, parameterizer and generator are shared by all workers, with the per-path goal, limits
+     * and overrun kept in caller-owned contexts (see @ref grpl::pf::profile::profile::context and
+     * @ref grpl::pf::path::arc_parameterizer::context). Each worker has its own scratch buffers (splines,
+     * curves), allocated on construction. Generating does not allocate, provided the requests fit within
+     * the maximum sizes given on construction.
+     *
+     * @param hermite_t The type of hermite spline to fit the waypoints with.
+     * @param profile_t The type of profile to use for generation.
+     * @param chassis_t The type of chassis (or @ref chassis_envelope) to generate with.
+     */
+    template <typename hermite_t = path::hermite_quintic, typename profile_t = profile::trapezoidal,
+              typename chassis_t = chassis>
+    class batch_trajectory_generator {
+     public:
+      using waypoint_t = typename hermite_t::waypoint;
+      using curve_t    = path::arc_parameterizer::curve_t;
+
+      /**
+       * A single path to generate.
+       */
+      struct request {
+        //! Pointer to the first waypoint of the path.
+        const waypoint_t *waypoints = nullptr;
+        //! The number of waypoints in the path.
+        size_t waypoint_count = 0;
+        //! Output buffer for the full trajectory. May be nullptr if only the metrics are required.
+        state *trajectory = nullptr;
+        //! The maximum number of states in the trajectory output buffer.
+        size_t max_states = 0;
+      };
+
+      /**
+       * Summary metrics of a single generated path.
+       */
+      struct result {
+        //! Whether the trajectory reached the end of the path before the timeout.
+        bool finished = false;
+        //! Whether a buffer (splines, curves or trajectory) was too small for the path.
+        bool overrun = false;
+        //! The number of states generated. Only the first max_states are written to the trajectory buffer.
+        size_t state_count = 0;
+        //! The total time of the trajectory, in seconds.
+        double time = 0;
+        //! The peak current drawn by either transmission, in Amperes.
+        double peak_current = 0;
+      };
+
+      /**
+       * Construct a batch trajectory generator.
+       *
+       * @param pool          The thread pool to run generation on, held internally as a reference.
+       * @param chassis       The chassis to generate with, held internally as a reference. The chassis must
+       *                      be safe to share between threads (@ref chassis is, as long as its transmissions
+       *                      are).
+       * @param profile       The profile to generate with, copied and shared between all workers.
+       * @param param         The configured arc parameterizer, copied and shared between all workers.
+       * @param max_waypoints The maximum number of waypoints in a single request.
+       * @param max_curves    The maximum number of curves a single request may be parameterized into.
+       * @param dt            The timestep of the generated trajectories, in seconds.
+       * @param timeout       The maximum time of a generated trajectory, in seconds. Paths that take longer
+       *                      are marked as unfinished.
+       */
+      batch_trajectory_generator(util::thread_pool &pool, const chassis_t &chassis, const profile_t &profile,
+                                 const path::arc_parameterizer &param, size_t max_waypoints,
+                                 size_t max_curves, double dt, double timeout = 15)
+          : _pool(pool), _chassis(chassis), _profile(profile), _param(param), _dt(dt), _timeout(timeout) {
+        _workers.reserve(pool.size());
+        for (size_t i = 0; i < pool.size(); i++) _workers.emplace_back(max_waypoints, max_curves);
+      }
+
+      /**
+       * Generate trajectories for a batch of path requests, blocking until all are complete.
+       *
+       * @param requests  Pointer to the first path request.
+       * @param results   Output buffer for the results, with space for count results. Results are in the
+       *                  same order as the requests.
+       * @param count     The number of requests.
+       */
+      void generate(const request *requests, result *results, size_t count) {
+        auto job = [this, requests, results](size_t idx, size_t worker) {
+          results[idx] = generate_one(_workers[worker], requests[idx]);
+        };
+        _pool.parallel_for(count, job);
+      }
+
+     private:
+      struct worker {
+        worker(size_t max_waypoints, size_t max_curves) : splines(max_waypoints), curves(max_curves) {}
+
+        std::vector<hermite_t> splines;
+        std::vector<curve_t>   curves;
+      };
+
+      result generate_one(worker &w, const request &req) const {
+        result res;
+
+        hermite_t *spline_out = w.splines.data();
+        size_t     spline_count =
+            path::hermite_factory::generate<hermite_t>(req.waypoints, req.waypoints + req.waypoint_count,
+                                                       spline_out, w.splines.size());
+        if (spline_count == 0) {
+          res.overrun = req.waypoint_count > w.splines.size();
+          return res;
+        }
+
+        path::arc_parameterizer::context param_ctx;
+
+        curve_t *curve_out   = w.curves.data();
+        size_t   curve_count = _param.parameterize(w.splines.begin(), w.splines.begin() + spline_count,
+                                                 curve_out, w.curves.size(), param_ctx);
+        if (param_ctx.overrun) {
+          res.overrun = true;
+          return res;
+        }
+
+        typename profile_t::context profile_ctx = _profile.get_context();
+        curve_t *                   curve_end   = w.curves.data() + curve_count;
+
+        state st;
+        for (double t = 0; !st.finished && t <= _timeout; t += _dt) {
+          st = _gen.generate(_chassis, w.curves.data(), curve_end, _profile, profile_ctx, st, t);
+
+          if (req.trajectory != nullptr) {
+            if (res.state_count < req.max_states)
+              req.trajectory[res.state_count] = st;
+            else
+              res.overrun = true;
+          }
+          res.state_count++;
+
+          std::pair<wheel_state, wheel_state> split = _chassis.split(st);
+          res.peak_current = std::max(res.peak_current, std::max(std::abs(split.first.current),
+                                                                 std::abs(split.second.current)));
+        }
+
+        res.finished = st.finished;
+        res.time     = st.time;
+        return res;
+      }
+
+      util::thread_pool &               _pool;
+      const chassis_t &                 _chassis;
+      const profile_t                   _profile;
+      const path::arc_parameterizer     _param;
+      const causal_trajectory_generator _gen{};
+      double                            _dt, _timeout;
+      std::vector<worker>               _workers;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
@@ -1,137 +1,249 @@
-#pragma once
-
-#include "chassis.h"
-#include "grpl/pf/path/curve.h"
-#include "grpl/pf/profile/profile.h"
-#include "state.h"
-
-namespace grpl {
-namespace pf {
-  namespace coupled {
-
-    /**
-     * Causal trajectory generator, given the chassis, path and motion profile.
-     *
-     * This class provides the necessary plumbing in order to generate trajectories from a given path,
-     * applying motion and timing information based on the limits and constraints of a drivetrain. The
-     * generator applies a motion profile to a path, while fitting within given constraints.
-     *
-     * This generator is causal and will generate a single state (output) with knowledge only of the current
-     * state of the system. This generator can be used on-the-fly, and is primarily advantageous in speed and
-     * flexibility. The cost is accuracy towards the end of the path, as a sudden deceleration may be required
-     * with insufficient time steps, as the end velocity may not be zero.
-     *
-     * It is recommended to use this generator if on-the-fly generation is required, or memory and
-     * computational resources are sparse. This generator also enables the ability to provide feedback
-     * information on chassis kinematics to the next generation step, making it possible to embed a feedback
-     * loop into the generation phase.
-     */
-    class causal_trajectory_generator {
-     public:
-      using vector_t = Eigen::Vector2d;
-
-      // TODO: Rename this class to something more fitting (drivetrain is a synonym for chassis). This
-      // class can also be split apart to migrate most calculation to chassis, while keeping only the
-      // parts required to follow a causal path within this class.
-
-      /**
-       * Generate the next state of the trajectory given the current state.
-       * 
-       * The curves in this system define the path that will be followed.
-       *
-       * @param chassis       The coupled chassis, used to provide limits for the trajectory the trajectory
-       *                      kinematics.
-       * @param curve_begin   Iterator pointing to the start of the curve collection. See @ref std::iterator.
-       * @param curve_end     Iterator pointing to the end of the curve collection. See @ref std::iterator.
-       * @param profile       Reference to the profile to use. The profile must, at a minimum, provide
-       *                      continous, bounded velocity and bounded acceleration.
-       *                      @ref grpl::pf::profile::trapezoidal is recommended.
-       * @param last          The current ("last") state of the trajectory. If this is the first call to
-       *                      generate, this may be considered the "initial conditions".
-       * @param time          The time of the next point (last.time + dt), in seconds.
-       */
-      template <typename iterator_curve_t>
-      state generate(chassis &chassis, const iterator_curve_t curve_begin, const iterator_curve_t curve_end,
-                     profile::profile &profile, state &last, double time) {
-        path::curve<2> *curve;
-        state           output;
-        double          total_length, curve_distance;
-        double          distance = last.kinematics[0];
-
-        curve = find_curve(distance, curve_begin, curve_end, curve_distance, total_length);
-
-        // TODO: The epsilon of the profile causes this to never advance, meaning the path
-        // is never marked as 'finished' on some timesteps.
-        if (curve == nullptr) {
-          output          = last;
-          output.finished = true;
-          return output;
-        }
-
-        profile.set_goal(total_length);
-
-        vector_t centre     = curve->position(curve_distance);
-        vector_t centre_rot = curve->rotation(curve_distance);
-        double   curvature  = curve->curvature(curve_distance);
-        double   dcurvature = curve->dcurvature(curve_distance);
-
-        double              heading = atan2(centre_rot.y(), centre_rot.x());
-        configuration_state config{centre.x(), centre.y(), heading};
-
-        output.time   = time;
-        output.config = config;
-
-        // TODO: Allow multiple constraints (like current limits)
-        // TODO: Enforce minimum acceleration constraints in profiles.
-        // TODO: Does limiting jerk prevent oscillation
-        double                    limit_vel = chassis.linear_vel_limit(config, curvature);
-        std::pair<double, double> limit_acc =
-            chassis.acceleration_limits(config, curvature, last.kinematics[1]);
-
-        profile.apply_limit(1, -limit_vel, limit_vel);
-        profile.apply_limit(2, limit_acc.first, limit_acc.second);
-
-        profile::state prof_state;
-        prof_state.time       = last.time;
-        prof_state.kinematics = last.kinematics;
-
-        prof_state = profile.calculate(prof_state, time);
-
-        output.kinematics = prof_state.kinematics;
-        output.curvature  = curvature;
-        output.dcurvature = dcurvature;
-
-        output.finished = false;
-        return output;
-      }
-
-     private:
-      // TODO: We can store the last known curve to make lookup faster, but will cause random-access slowdown.
-      // That's a fixable problem with a settable parameter to optimize for either sequential or random
-      // access.
-      template <typename iterator_curve_t>
-      inline path::curve<2> *find_curve(double targ_len, const iterator_curve_t curve_begin,
-                                        const iterator_curve_t curve_end, double &curve_len_out,
-                                        double &total_len_out) {
-        path::curve<2> *curve_out = nullptr;
-        curve_len_out             = targ_len;
-        total_len_out             = 0;
-
-        for (iterator_curve_t it = curve_begin; it != curve_end; it++) {
-          path::curve<2> &curr = *it;
-
-          double len = curr.length();
-          // If we haven't found a curve, and the current length of the curve will put us ahead
-          // of our distance target.
-          if (curve_out == nullptr && (len + total_len_out) >= targ_len) {
-            curve_len_out = targ_len - total_len_out;
-            curve_out     = &curr;
-          }
-          total_len_out += len;
-        }
-        return curve_out;
-      }
-    };
-  }  // namespace coupled
-}  // namespace pf
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/path/curve.h"
+#include "grpl/pf/profile/profile.h"
+#include "state.h"
+#include "velocity_lookahead.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Causal trajectory generator, given the chassis, path and motion profile.
+     *
+     * This class provides the necessary plumbing in order to generate trajectories from a given path,
+     * applying motion and timing information based on the limits and constraints of a drivetrain. The
+     * generator applies a motion profile to a path, while fitting within given constraints.
+     *
+     * This generator is causal and will generate a single state (output) with knowledge only of the current
+     * state of the system. This generator can be used on-the-fly, and is primarily advantageous in speed and
+     * flexibility. The cost is accuracy towards the end of the path, as a sudden deceleration may be required
+     * with insufficient time steps, as the end velocity may not be zero. This can be avoided by a precomputed
+     * @ref velocity_lookahead, which brakes ahead of time for the end of the path and for tight curves.
+     *
+     * It is recommended to use this generator if on-the-fly generation is required, or memory and
+     * computational resources are sparse. This generator also enables the ability to provide feedback
+     * information on chassis kinematics to the next generation step, making it possible to embed a feedback
+     * loop into the generation phase.
+     */
+    class causal_trajectory_generator {
+     public:
+      using vector_t = Eigen::Vector2d;
+
+      // TODO: Rename this class to something more fitting (drivetrain is a synonym for chassis). This
+      // class can also be split apart to migrate most calculation to chassis, while keeping only the
+      // parts required to follow a causal path within this class.
+
+      /**
+       * Generate the next state of the trajectory given the current state.
+       * 
+       * The curves in this system define the path that will be followed.
+       *
+       * The goal and limits of the profile are set on each call. Use the overload taking a
+       * @ref grpl::pf::profile::profile::context to generate without modifying the profile.
+       *
+       * @param chassis       The coupled chassis, used to provide limits for the trajectory the trajectory
+       *                      kinematics. A @ref chassis_envelope of the chassis may be used in its place, to
+       *                      use precomputed limits instead of the exact model.
+       * @param curve_begin   Iterator pointing to the start of the curve collection. See @ref std::iterator.
+       * @param curve_end     Iterator pointing to the end of the curve collection. See @ref std::iterator.
+       * @param profile       Reference to the profile to use. The profile must, at a minimum, provide
+       *                      continous, bounded velocity and bounded acceleration.
+       *                      @ref grpl::pf::profile::trapezoidal is recommended.
+       * @param last          The current ("last") state of the trajectory. If this is the first call to
+       *                      generate, this may be considered the "initial conditions".
+       * @param time          The time of the next point (last.time + dt), in seconds.
+       */
+      template <typename iterator_curve_t, typename chassis_t = chassis>
+      state generate(const chassis_t &chassis, const iterator_curve_t curve_begin,
+                     const iterator_curve_t curve_end, profile::profile &profile, state &last, double time) {
+        const profile::profile &  shared = profile;
+        profile::profile::context ctx    = profile.get_context();
+
+        state output = generate(chassis, curve_begin, curve_end, shared, ctx, last, time);
+        profile.set_context(ctx);
+        return output;
+      }
+
+      /**
+       * Generate the next state of the trajectory given the current state, keeping the goal and limits of
+       * the profile in a caller-owned context.
+       *
+       * This method modifies neither the generator nor the profile, so a single generator and profile may be
+       * used to generate many trajectories concurrently, with one context per trajectory.
+       *
+       * @param chassis       The coupled chassis, used to provide limits for the trajectory. A
+       *                      @ref chassis_envelope of the chassis may be used in its place.
+       * @param curve_begin   Iterator pointing to the start of the curve collection. See @ref std::iterator.
+       * @param curve_end     Iterator pointing to the end of the curve collection. See @ref std::iterator.
+       * @param profile       Reference to the profile to use.
+       * @param ctx           The profile context of this trajectory. The goal and limits used to calculate
+       *                      the next state are written to the context.
+       * @param last          The current ("last") state of the trajectory. If this is the first call to
+       *                      generate, this may be considered the "initial conditions".
+       * @param time          The time of the next point (last.time + dt), in seconds.
+       */
+      template <typename iterator_curve_t, typename chassis_t = chassis>
+      state generate(const chassis_t &chassis, const iterator_curve_t curve_begin,
+                     const iterator_curve_t curve_end, const profile::profile &profile,
+                     profile::profile::context &ctx, const state &last, double time) const {
+        path::curve<2> *curve;
+        double          total_length, curve_distance;
+        double          distance = last.kinematics[0];
+
+        curve = find_curve(distance, curve_begin, curve_end, curve_distance, total_length);
+        return generate_at(chassis, curve, curve_distance, total_length, profile, ctx, last, time);
+      }
+
+      /**
+       * Generate the next state of the trajectory given the current state, braking ahead of time for the
+       * limits of the path ahead by a precomputed @ref velocity_lookahead.
+       *
+       * The velocity is limited to the maximum safe velocity of the lookahead at the position reached by the
+       * next state (if travelling at the current velocity), such that the trajectory decelerates within the
+       * limits of the chassis for tight curves ahead and for the end of the path.
+       *
+       * @param chassis       The coupled chassis, used to provide limits for the trajectory.
+       * @param curve_begin   Iterator pointing to the start of the curve collection. See @ref std::iterator.
+       * @param curve_end     Iterator pointing to the end of the curve collection. See @ref std::iterator.
+       * @param profile       Reference to the profile to use.
+       * @param ctx           The profile context of this trajectory.
+       * @param lookahead     The lookahead table, built for the same chassis and curves.
+       * @param last          The current ("last") state of the trajectory.
+       * @param time          The time of the next point (last.time + dt), in seconds.
+       */
+      template <typename iterator_curve_t, typename chassis_t = chassis>
+      state generate(const chassis_t &chassis, const iterator_curve_t curve_begin,
+                     const iterator_curve_t curve_end, const profile::profile &profile,
+                     profile::profile::context &ctx, const velocity_lookahead &lookahead, const state &last,
+                     double time) const {
+        path::curve<2> *curve;
+        double          total_length, curve_distance;
+        double          distance = last.kinematics[0];
+
+        curve = find_curve(distance, curve_begin, curve_end, curve_distance, total_length);
+        return generate_at(chassis, curve, curve_distance, total_length, profile, ctx, last, time,
+                           lookahead_velocity(lookahead, last, time));
+      }
+
+      /**
+       * Generate the next state of the trajectory given the current state, with the curve containing the
+       * current state already found.
+       *
+       * This is the part of @ref generate() following the search for the current curve, for use by
+       * generators that find the curve by other means (e.g. @ref realtime_trajectory_generator).
+       *
+       * @param chassis         The coupled chassis, used to provide limits for the trajectory.
+       * @param curve           The curve containing the current state, or nullptr if the current state is
+       *                        past the end of the path.
+       * @param curve_distance  The distance of the current state along the curve, in metres.
+       * @param total_length    The total length of the path, in metres.
+       * @param profile         Reference to the profile to use.
+       * @param ctx             The profile context of this trajectory.
+       * @param last            The current ("last") state of the trajectory.
+       * @param time            The time of the next point (last.time + dt), in seconds.
+       * @param max_velocity    An additional limit on the velocity, in metres per second (ms^-1), such as
+       *                        given by a @ref velocity_lookahead.
+       */
+      template <typename chassis_t = chassis>
+      static state generate_at(const chassis_t &chassis, path::curve<2> *curve, double curve_distance,
+                               double total_length, const profile::profile &profile,
+                               profile::profile::context &ctx, const state &last, double time,
+                               double max_velocity = std::numeric_limits<double>::infinity()) {
+        state output;
+
+        // TODO: The epsilon of the profile causes this to never advance, meaning the path
+        // is never marked as 'finished' on some timesteps.
+        if (curve == nullptr) {
+          output          = last;
+          output.finished = true;
+          return output;
+        }
+
+        ctx.goal = total_length;
+
+        vector_t centre     = curve->position(curve_distance);
+        vector_t centre_rot = curve->rotation(curve_distance);
+        double   curvature  = curve->curvature(curve_distance);
+        double   dcurvature = curve->dcurvature(curve_distance);
+
+        double              heading = atan2(centre_rot.y(), centre_rot.x());
+        configuration_state config{centre.x(), centre.y(), heading};
+
+        output.time   = time;
+        output.config = config;
+
+        // Additional constraints (e.g. current limits) are applied by the chassis, see constrained_chassis.
+        // TODO: Enforce minimum acceleration constraints in profiles.
+        // TODO: Does limiting jerk prevent oscillation
+        double                    limit_vel = chassis.linear_vel_limit(config, curvature);
+        std::pair<double, double> limit_acc =
+            chassis.acceleration_limits(config, curvature, last.kinematics[1]);
+
+        limit_vel = std::min(limit_vel, max_velocity);
+        ctx.apply_limit(1, -limit_vel, limit_vel);
+        ctx.apply_limit(2, limit_acc.first, limit_acc.second);
+
+        profile::state prof_state;
+        prof_state.time       = last.time;
+        prof_state.kinematics = last.kinematics;
+
+        prof_state = profile.calculate(ctx, prof_state, time);
+
+        output.kinematics = prof_state.kinematics;
+        output.curvature  = curvature;
+        output.dcurvature = dcurvature;
+
+        output.finished = false;
+        return output;
+      }
+
+      /**
+       * Get the maximum safe velocity of a lookahead table at the position reached by the next state, if
+       * travelling at the current velocity.
+       *
+       * @param lookahead The lookahead table.
+       * @param last      The current ("last") state of the trajectory.
+       * @param time      The time of the next point (last.time + dt), in seconds.
+       * @return          The maximum safe velocity, in metres per second (ms^-1).
+       */
+      static double lookahead_velocity(const velocity_lookahead &lookahead, const state &last, double time) {
+        double dt = std::max(0.0, time - last.time);
+        return lookahead.max_velocity(last.kinematics[POSITION] + std::abs(last.kinematics[VELOCITY]) * dt);
+      }
+
+     private:
+      // TODO: We can store the last known curve to make lookup faster, but will cause random-access slowdown.
+      // That's a fixable problem with a settable parameter to optimize for either sequential or random
+      // access.
+      template <typename iterator_curve_t>
+      inline path::curve<2> *find_curve(double targ_len, const iterator_curve_t curve_begin,
+                                        const iterator_curve_t curve_end, double &curve_len_out,
+                                        double &total_len_out) const {
+        path::curve<2> *curve_out = nullptr;
+        curve_len_out             = targ_len;
+        total_len_out             = 0;
+
+        for (iterator_curve_t it = curve_begin; it != curve_end; it++) {
+          path::curve<2> &curr = *it;
+
+          double len = curr.length();
+          // If we haven't found a curve, and the current length of the curve will put us ahead
+          // of our distance target.
+          if (curve_out == nullptr && (len + total_len_out) >= targ_len) {
+            curve_len_out = targ_len - total_len_out;
+            curve_out     = &curr;
+          }
+          total_len_out += len;
+        }
+        return curve_out;
+      }
+    };
+  }  // namespace coupled
+}  // namespace pf
 }  // namespace grpl
\ No newline at end of file
@@ -1,293 +1,433 @@
-#pragma once
-
-#include "chassis.h"
-#include "grpl/pf/constants.h"
-#include "grpl/pf/transmission/dc.h"
-#include "state.h"
-
-namespace grpl {
-namespace pf {
-  namespace coupled {
-
-    /**
-     * Mathematical model representation of a coupled (tank / differential) drivetrain.
-     *
-     * Chassis contains members for the transmissions (motors), as well as other configurations
-     * regarding the chassis (track radius, wheel radius, mass, etc).
-     *
-     * The chassis mirrors the physical "layout" of the drivetrain.
-     *
-     * @ref grpl::pf::coupled::causal_trajectory_generator
-     */
-    class chassis {
-     public:
-      using transmission_t = transmission::dc_transmission;
-
-      /**
-       * Construct a coupled chassis
-       *
-       * @param transmission_left   The left side transmission, held internally as a reference.
-       * @param transmission_right  The right side transmission, held internally as a reference.
-       * @param wheel_radius        The wheel radius, in metres. Should be emperically measured
-       *                            for best performance. Note that both the left and right
-       *                            transmission wheels must be the same radius.
-       * @param track_radius        The track radius, a.k.a half the chassis width, in metres.
-       *                            Measured as half the distance between the centres of the left
-       *                            and right transmissions at their points of contact with the ground.
-       * @param mass                The mass of the chassis, in kilograms.
-       */
-      chassis(transmission_t &transmission_left, transmission_t &transmission_right, double wheel_radius,
-              double track_radius, double mass)
-          : _trans_left(transmission_left),
-            _trans_right(transmission_right),
-            _wheel_radius(wheel_radius),
-            _track_radius(track_radius),
-            _mass(mass) {}
-
-      /**
-       * @return The mass of the chassis, in kilograms
-       */
-      double mass() const { return _mass; }
-
-      /**
-       * @return  The track radius (half the chassis width) in metres. Measured
-       *          between the left and right transmissions.
-       */
-      double track_radius() const { return _track_radius; }
-
-      /**
-       * @return  The wheel radius, in metres.
-       */
-      double wheel_radius() const { return _wheel_radius; }
-
-      /**
-       * @return  Reference to the left-side transmission of the chassis.
-       */
-      transmission_t &transmission_left() const { return _trans_left; }
-
-      /**
-       * @return  Reference to the right-side transmission of the chassis.
-       */
-      transmission_t &transmission_right() const { return _trans_right; }
-
-      /**
-       * Calculate the absolute linear (translational) velocity limit of the chassis in metres
-       * per second (ms^-1).
-       *
-       * This calculation relates purely to the free-speed of the motors, meaning for a fully
-       * constrained calculation, @ref acceleration_limits(configuration_state&, double, double)
-       * should be called and used to constrain the velocity if necessary.
-       *
-       * @param config    The configuration of the chassis
-       * @param curvature The instantaneous curvature, in metres^-1, expected of the chassis,
-       *                  such as the curvature of a path being followed.
-       *
-       * @return  The absolute linear (translational) velocity limit in metres per second (ms^-2).
-       */
-      double linear_vel_limit(const configuration_state &config, double curvature) const {
-        // Infinite curvature, point turn (purely angular), therefore no linear velocity.
-        if (std::abs(curvature) > constants::almost_inf) return 0;
-
-        // Wheel linear speed, maximum possible speeds
-        // Ordered left, right.
-        Eigen::Vector2d maximum_vels{
-            _trans_left.get_free_speed(_trans_left.nominal_voltage()) * _wheel_radius,
-            _trans_right.get_free_speed(_trans_right.nominal_voltage()) * _wheel_radius};
-
-        if (std::abs(curvature) < constants::epsilon) {
-          // No curvature, straight forward (purely linear). Need to take minimum as for
-          // differing transmissions there may be a non-equal speed limit. We can skip all
-          // the logic below to be more efficient. We return eagerly.
-          return maximum_vels.minCoeff();
-        } else {
-          // Take the maximum speed of each wheel, then limit the opposing one, ensuring
-          // we are within the limits above.
-
-          // Wheel linear speed, actual values.
-          // Ordered left, right.
-          Eigen::Vector2d wheel_vels;
-
-          // v_c = 0.5*(v_r + v_l)                [1] Linear Velocity
-          // w   = 0.5*(v_r - v_l) / r            [2] Angular Velocity
-          // k = w / v_c                          [3] Curvature
-          // note w / v_c has 0.5 as common factor, cancels out for the following
-          // k = ((v_r - v_l)/r) / (v_r + v_l)
-          // rk = (v_r - v_l) / (v_r + v_l)
-          // v_r(1 - rk) = v_l(1 + rk)            [4]
-          // let ratio = (1 - rk) / (1 + rk)
-          double ratio = (1 - _track_radius * curvature) / (1 + _track_radius * curvature);
-          // v_l = v_r * ratio                    [5]
-          // v_r = v_l / ratio                    [6]
-
-          // TODO: This can all be compressed using some clever linalg
-          if (curvature > 0) {
-            // Banking counter-clockwise (steering to the left, right side dominant)
-            // therefore, v_r = maximum freespeed
-            wheel_vels[1] = maximum_vels[1];
-            // v_l = v_r * ratio                  via [5]
-            wheel_vels[0] = wheel_vels[1] * ratio;
-
-            if (wheel_vels[0] > maximum_vels[0]) {
-              // Left side is over it's maximum speed - cap it to its maximum speed, then
-              // limit the right side.
-              wheel_vels[0] = maximum_vels[0];
-              // v_r = v_l / ratio                via [6]
-              wheel_vels[1] = wheel_vels[0] / ratio;
-            }
-          } else {
-            // Banking clockwise (steering to the right, left side dominant)
-            // therefore, v_l = maximum freespeed
-            wheel_vels[0] = maximum_vels[0];
-            // v_r = v_l / ratio                  via [6]
-            wheel_vels[1] = wheel_vels[0] / ratio;
-
-            if (wheel_vels[0] > maximum_vels[0]) {
-              // Right side is over it's maximum speed - cap it to its maximum speed, then
-              // limit the left side.
-              wheel_vels[1] = maximum_vels[1];
-              // v_l = v_r * ratio                via [5]
-              wheel_vels[0] = wheel_vels[1] * ratio;
-            }
-          }
-
-          // Maximum Linear Velocity              via [1]
-          return wheel_vels.sum() / 2.0;
-        }
-      }
-
-      /**
-       * Calculate the minimum and maximum linear (translational) acceleration limits of the chassis,
-       * in metres per second per second (ms^-2).
-       *
-       * This calculation uses torque limits of the transmissions, meaning speed limits
-       * are not directly taken into account. For a fully constrained representation,
-       * @ref linear_vel_limit(configuration_state&, double) must also be called and used to constrain
-       * if necessary.
-       *
-       * @param config    The configuration of the chassis
-       * @param curvature The instantaneous curvature, in metres^-1, expected of the chassis,
-       *                  such as the curvature of a path being followed.
-       * @param velocity  The current linear velocity of the chassis, in metres per second (ms^-1).
-       *
-       * @return  A pair, ordered [min, max], of the linear acceleration limits, in metres per second
-       *          per second (ms^-2).
-       */
-      std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
-                                                    double velocity) const {
-        double linear = velocity;
-        // k = w / v, w = v * k
-        double angular = velocity * curvature;
-        // v_diff = w * r
-        double differential = angular * _track_radius;
-
-        // v_r = v + v_diff, w_r = v_r / r_wheel
-        // v_l = v - v_diff, w_l = v_l / r_wheel
-        // Ordered right, left.
-        Eigen::Vector2d wheels{(linear + differential) / _wheel_radius,
-                               (linear - differential) / _wheel_radius};
-
-        // Calculate fwd torque limits for each side
-        Eigen::Vector2d fwd_torque_limits{
-            _trans_right.get_torque(_trans_right.get_current(_trans_right.nominal_voltage(), wheels[0])),
-            _trans_left.get_torque(_trans_left.get_current(_trans_left.nominal_voltage(), wheels[1]))};
-
-        Eigen::Vector2d fwd_accel_limits = fwd_torque_limits / (_mass * _wheel_radius);
-
-        double max = fwd_accel_limits.sum() / 2.0;
-
-        // Calculate rvs torque limits for each side
-        Eigen::Vector2d rvs_torque_limits{
-            _trans_right.get_torque(-_trans_right.get_current(_trans_right.nominal_voltage(), wheels[0])),
-            _trans_left.get_torque(-_trans_left.get_current(_trans_left.nominal_voltage(), wheels[1]))};
-
-        Eigen::Vector2d rvs_accel_limits = rvs_torque_limits / (_mass * _wheel_radius);
-
-        double min = rvs_accel_limits.sum() / 2.0;
-
-        return std::pair<double, double>{min, max};
-      }
-
-      /**
-       * Split a centre state of this chassis into the left and right transmission state components.
-       *
-       * @return  A pair, ordered [left, right], of @ref wheel_state.
-       */
-      std::pair<wheel_state, wheel_state> split(const state centre) const {
-        wheel_state left, right;
-
-        left.time = right.time = centre.time;
-        left.finished = right.finished = centre.finished;
-
-        // Split positions
-        wheel_state::vector_t position{centre.config.x(), centre.config.y()};
-        double                heading = centre.config[2];
-        wheel_state::vector_t p_offset{0, _track_radius};
-
-        Eigen::Matrix<double, 2, 2> rotation;
-        rotation << cos(heading), -sin(heading), sin(heading), cos(heading);
-
-        // Rotate the wheel offsets by the heading of the robot, adding it to the
-        // centre position, this 'splits' the centre path into two paths constrained
-        // by the configuration (heading + position) and track radius.
-        left.position  = position + rotation * p_offset;
-        right.position = position - rotation * p_offset;
-
-        // Split velocities
-        double v_linear            = centre.kinematics[VELOCITY];
-        double v_angular           = v_linear * centre.curvature;
-        double v_differential      = v_angular * _track_radius;
-        left.kinematics[VELOCITY]  = v_linear - v_differential;
-        right.kinematics[VELOCITY] = v_linear + v_differential;
-
-        // Split accelerations
-        double a_linear = centre.kinematics[ACCELERATION];
-        // This is a bit of a tricky one, so don't blink
-        // a_angular = dw / dt (where w = v_angular)
-        // a_angular = d/dt (v * k) (from v_angular above, w = vk)
-        // Then, by product rule:
-        //    a_angular = dv/dt * k + v * dk/dt     (note dv/dt is acceleration)
-        //    a_angular = a * k + v * dk/dt         [1]
-        // We don't have dk/dt, but we do have dk/ds. By chain rule:
-        //    dk/dt = dk/ds * ds/dt                 (note ds/dt is velocity)
-        //    dk/dt = dk/ds * v                     [2]
-        // Therefore, by composing [1] and [2],
-        //    a_angular = a * k + v^2 * dk/ds
-        // Isn't that just a gorgeous piece of math?
-        double a_angular              = a_linear * centre.curvature + v_linear * v_linear * centre.dcurvature;
-        double a_differential         = a_angular * _track_radius;
-        left.kinematics[ACCELERATION] = a_linear - a_differential;
-        right.kinematics[ACCELERATION] = a_linear + a_differential;
-
-        solve_electrical(left, right);
-
-        return std::pair<wheel_state, wheel_state>{left, right};
-      }
-
-     private:
-      void solve_electrical(wheel_state &left, wheel_state &right) const {
-        do_solve_electrical(left, _trans_left);
-        do_solve_electrical(right, _trans_right);
-      }
-
-      // TODO: Make this part of transmission_t
-      void do_solve_electrical(wheel_state &wheel, transmission_t &transmission) const {
-        double speed        = wheel.kinematics[VELOCITY] / _wheel_radius;
-        double free_voltage = transmission.get_free_voltage(speed);
-
-        double torque          = _mass * wheel.kinematics[ACCELERATION] * _wheel_radius;
-        double current         = transmission.get_torque_current(torque);
-        double current_voltage = transmission.get_current_voltage(current);
-
-        double total_voltage = free_voltage + current_voltage;
-
-        wheel.voltage = total_voltage;
-        wheel.current = current;
-      }
-
-      double _mass, _track_radius, _wheel_radius;
-      // TODO: Not reference
-      transmission_t &_trans_left, &_trans_right;
-    };
-  }  // namespace coupled
-}  // namespace pf
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/constants.h"
+#include "grpl/pf/transmission/dc.h"
+#include "state.h"
+#include "wheel_track.h"
+
+#include <cmath>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Mathematical model representation of a coupled (tank / differential) drivetrain.
+     *
+     * Chassis contains members for the transmissions (motors), as well as other configurations
+     * regarding the chassis (track radius, wheel radius, mass, etc).
+     *
+     * The chassis mirrors the physical "layout" of the drivetrain.
+     *
+     * The chassis is templated on the types of its transmissions. @ref chassis uses the polymorphic
+     * @ref grpl::pf::transmission::dc_transmission, allowing any transmission (including those provided
+     * by other languages) to be used. If the transmissions are known at compile time, using their concrete
+     * types (e.g. basic_chassis<dc_motor, dc_motor>) removes the virtual calls, allowing the transmission
+     * models to be inlined and the left and right sides to be calculated together.
+     *
+     * @ref grpl::pf::coupled::causal_trajectory_generator
+     */
+    template <typename transmission_left_type, typename transmission_right_type>
+    class basic_chassis {
+     public:
+      using transmission_left_t  = transmission_left_type;
+      using transmission_right_t = transmission_right_type;
+
+      /**
+       * Construct a coupled chassis
+       *
+       * @param transmission_left   The left side transmission, held internally as a reference.
+       * @param transmission_right  The right side transmission, held internally as a reference.
+       * @param wheel_radius        The wheel radius, in metres. Should be emperically measured
+       *                            for best performance. Note that both the left and right
+       *                            transmission wheels must be the same radius.
+       * @param track_radius        The track radius, a.k.a half the chassis width, in metres.
+       *                            Measured as half the distance between the centres of the left
+       *                            and right transmissions at their points of contact with the ground.
+       * @param mass                The mass of the chassis, in kilograms.
+       */
+      basic_chassis(transmission_left_t &transmission_left, transmission_right_t &transmission_right,
+                    double wheel_radius, double track_radius, double mass)
+          : _trans_left(transmission_left),
+            _trans_right(transmission_right),
+            _wheel_radius(wheel_radius),
+            _track_radius(track_radius),
+            _mass(mass) {}
+
+      /**
+       * @return The mass of the chassis, in kilograms
+       */
+      double mass() const { return _mass; }
+
+      /**
+       * @return  The track radius (half the chassis width) in metres. Measured
+       *          between the left and right transmissions.
+       */
+      double track_radius() const { return _track_radius; }
+
+      /**
+       * @return  The wheel radius, in metres.
+       */
+      double wheel_radius() const { return _wheel_radius; }
+
+      /**
+       * @return  Reference to the left-side transmission of the chassis.
+       */
+      transmission_left_t &transmission_left() const { return _trans_left; }
+
+      /**
+       * @return  Reference to the right-side transmission of the chassis.
+       */
+      transmission_right_t &transmission_right() const { return _trans_right; }
+
+      /**
+       * Calculate the absolute linear (translational) velocity limit of the chassis in metres
+       * per second (ms^-1).
+       *
+       * This calculation relates purely to the free-speed of the motors, meaning for a fully
+       * constrained calculation, @ref acceleration_limits(configuration_state&, double, double)
+       * should be called and used to constrain the velocity if necessary.
+       *
+       * @param config    The configuration of the chassis
+       * @param curvature The instantaneous curvature, in metres^-1, expected of the chassis,
+       *                  such as the curvature of a path being followed.
+       *
+       * @return  The absolute linear (translational) velocity limit in metres per second (ms^-2).
+       */
+      double linear_vel_limit(const configuration_state &config, double curvature) const {
+        // Infinite curvature, point turn (purely angular), therefore no linear velocity.
+        if (std::abs(curvature) > constants::almost_inf) return 0;
+
+        // Wheel linear speed, maximum possible speeds
+        // Ordered left, right.
+        Eigen::Vector2d maximum_vels{
+            _trans_left.get_free_speed(_trans_left.nominal_voltage()) * _wheel_radius,
+            _trans_right.get_free_speed(_trans_right.nominal_voltage()) * _wheel_radius};
+
+        if (std::abs(curvature) < constants::epsilon) {
+          // No curvature, straight forward (purely linear). Need to take minimum as for
+          // differing transmissions there may be a non-equal speed limit. We can skip all
+          // the logic below to be more efficient. We return eagerly.
+          return maximum_vels.minCoeff();
+        } else {
+          // Take the maximum speed of each wheel, then limit the opposing one, ensuring
+          // we are within the limits above.
+
+          // Wheel linear speed, actual values.
+          // Ordered left, right.
+          Eigen::Vector2d wheel_vels;
+
+          // v_c = 0.5*(v_r + v_l)                [1] Linear Velocity
+          // w   = 0.5*(v_r - v_l) / r            [2] Angular Velocity
+          // k = w / v_c                          [3] Curvature
+          // note w / v_c has 0.5 as common factor, cancels out for the following
+          // k = ((v_r - v_l)/r) / (v_r + v_l)
+          // rk = (v_r - v_l) / (v_r + v_l)
+          // v_r(1 - rk) = v_l(1 + rk)            [4]
+          // let ratio = (1 - rk) / (1 + rk)
+          double ratio = (1 - _track_radius * curvature) / (1 + _track_radius * curvature);
+          // v_l = v_r * ratio                    [5]
+          // v_r = v_l / ratio                    [6]
+
+          // TODO: This can all be compressed using some clever linalg
+          if (curvature > 0) {
+            // Banking counter-clockwise (steering to the left, right side dominant)
+            // therefore, v_r = maximum freespeed
+            wheel_vels[1] = maximum_vels[1];
+            // v_l = v_r * ratio                  via [5]
+            wheel_vels[0] = wheel_vels[1] * ratio;
+
+            if (wheel_vels[0] > maximum_vels[0]) {
+              // Left side is over it's maximum speed - cap it to its maximum speed, then
+              // limit the right side.
+              wheel_vels[0] = maximum_vels[0];
+              // v_r = v_l / ratio                via [6]
+              wheel_vels[1] = wheel_vels[0] / ratio;
+            }
+          } else {
+            // Banking clockwise (steering to the right, left side dominant)
+            // therefore, v_l = maximum freespeed
+            wheel_vels[0] = maximum_vels[0];
+            // v_r = v_l / ratio                  via [6]
+            wheel_vels[1] = wheel_vels[0] / ratio;
+
+            if (wheel_vels[1] > maximum_vels[1]) {
+              // Right side is over it's maximum speed - cap it to its maximum speed, then
+              // limit the left side.
+              wheel_vels[1] = maximum_vels[1];
+              // v_l = v_r * ratio                via [5]
+              wheel_vels[0] = wheel_vels[1] * ratio;
+            }
+          }
+
+          // Maximum Linear Velocity              via [1]
+          return wheel_vels.sum() / 2.0;
+        }
+      }
+
+      /**
+       * Calculate the minimum and maximum linear (translational) acceleration limits of the chassis,
+       * in metres per second per second (ms^-2).
+       *
+       * This calculation uses torque limits of the transmissions, meaning speed limits
+       * are not directly taken into account. For a fully constrained representation,
+       * @ref linear_vel_limit(configuration_state&, double) must also be called and used to constrain
+       * if necessary.
+       *
+       * @param config    The configuration of the chassis
+       * @param curvature The instantaneous curvature, in metres^-1, expected of the chassis,
+       *                  such as the curvature of a path being followed.
+       * @param velocity  The current linear velocity of the chassis, in metres per second (ms^-1).
+       *
+       * @return  A pair, ordered [min, max], of the linear acceleration limits, in metres per second
+       *          per second (ms^-2).
+       */
+      std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
+                                                    double velocity) const {
+        double linear = velocity;
+        // k = w / v, w = v * k
+        double angular = velocity * curvature;
+        // v_diff = w * r
+        double differential = angular * _track_radius;
+
+        // v_r = v + v_diff, w_r = v_r / r_wheel
+        // v_l = v - v_diff, w_l = v_l / r_wheel
+        // Ordered right, left.
+        Eigen::Vector2d wheels{(linear + differential) / _wheel_radius,
+                               (linear - differential) / _wheel_radius};
+
+        // Current drawn by each side at full voltage. Ordered right, left.
+        Eigen::Vector2d currents{_trans_right.get_current(_trans_right.nominal_voltage(), wheels[0]),
+                                 _trans_left.get_current(_trans_left.nominal_voltage(), wheels[1])};
+
+        // Calculate fwd torque limits for each side
+        Eigen::Vector2d fwd_torque_limits{_trans_right.get_torque(currents[0]),
+                                          _trans_left.get_torque(currents[1])};
+
+        Eigen::Vector2d fwd_accel_limits = fwd_torque_limits / (_mass * _wheel_radius);
+
+        double max = fwd_accel_limits.sum() / 2.0;
+
+        // Calculate rvs torque limits for each side
+        Eigen::Vector2d rvs_torque_limits{_trans_right.get_torque(-currents[0]),
+                                          _trans_left.get_torque(-currents[1])};
+
+        Eigen::Vector2d rvs_accel_limits = rvs_torque_limits / (_mass * _wheel_radius);
+
+        double min = rvs_accel_limits.sum() / 2.0;
+
+        return std::pair<double, double>{min, max};
+      }
+
+      /**
+       * Split a centre state of this chassis into the left and right transmission state components.
+       *
+       * @return  A pair, ordered [left, right], of @ref wheel_state.
+       */
+      std::pair<wheel_state, wheel_state> split(const state centre) const {
+        wheel_state left, right;
+
+        left.time = right.time = centre.time;
+        left.finished = right.finished = centre.finished;
+
+        // Split positions
+        wheel_state::vector_t position{centre.config.x(), centre.config.y()};
+        double                heading = centre.config[2];
+        wheel_state::vector_t p_offset{0, _track_radius};
+
+        Eigen::Matrix<double, 2, 2> rotation;
+        rotation << cos(heading), -sin(heading), sin(heading), cos(heading);
+
+        // Rotate the wheel offsets by the heading of the robot, adding it to the
+        // centre position, this 'splits' the centre path into two paths constrained
+        // by the configuration (heading + position) and track radius.
+        left.position  = position + rotation * p_offset;
+        right.position = position - rotation * p_offset;
+
+        // Split velocities
+        double v_linear            = centre.kinematics[VELOCITY];
+        double v_angular           = v_linear * centre.curvature;
+        double v_differential      = v_angular * _track_radius;
+        left.kinematics[VELOCITY]  = v_linear - v_differential;
+        right.kinematics[VELOCITY] = v_linear + v_differential;
+
+        // Split accelerations
+        double a_linear = centre.kinematics[ACCELERATION];
+        // This is a bit of a tricky one, so don't blink
+        // a_angular = dw / dt (where w = v_angular)
+        // a_angular = d/dt (v * k) (from v_angular above, w = vk)
+        // Then, by product rule:
+        //    a_angular = dv/dt * k + v * dk/dt     (note dv/dt is acceleration)
+        //    a_angular = a * k + v * dk/dt         [1]
+        // We don't have dk/dt, but we do have dk/ds. By chain rule:
+        //    dk/dt = dk/ds * ds/dt                 (note ds/dt is velocity)
+        //    dk/dt = dk/ds * v                     [2]
+        // Therefore, by composing [1] and [2],
+        //    a_angular = a * k + v^2 * dk/ds
+        // Isn't that just a gorgeous piece of math?
+        double a_angular              = a_linear * centre.curvature + v_linear * v_linear * centre.dcurvature;
+        double a_differential         = a_angular * _track_radius;
+        left.kinematics[ACCELERATION] = a_linear - a_differential;
+        right.kinematics[ACCELERATION] = a_linear + a_differential;
+
+        solve_electrical(left, right);
+
+        return std::pair<wheel_state, wheel_state>{left, right};
+      }
+
+      /**
+       * Split a sequence of centre states of this chassis into the left and right wheel tracks.
+       *
+       * This is the batch equivalent of @ref split(const state) const, producing the same results for
+       * each state. The states are processed column-by-column in several passes over the tracks, such
+       * that the heading trigonometry, kinematics and electrical solve (one call per transmission, see
+       * @ref grpl::pf::transmission::dc_transmission::solve_electrical) are each a single loop over
+       * contiguous arrays, which the compiler may vectorize.
+       *
+       * @param state_begin   Iterator to the first centre state.
+       * @param state_end     Iterator to the end of the centre states.
+       * @param left          The left wheel track to write into.
+       * @param right         The right wheel track to write into.
+       * @return              The number of states split. If the tracks do not have the capacity for all the
+       *                      states, only the first states are split.
+       */
+      template <typename iterator_state_t>
+      size_t split(const iterator_state_t state_begin, const iterator_state_t state_end, wheel_track &left,
+                   wheel_track &right) const {
+        size_t n = 0;
+
+        // Gather the centre states into columns. Columns that are not yet written are used to hold the
+        // heading, curvature and change in curvature until they're needed.
+        double *heading    = right._x.data();
+        double *curvature  = right._velocity.data();
+        double *dcurvature = right._acceleration.data();
+        for (iterator_state_t it = state_begin; it != state_end && n < left._capacity && n < right._capacity;
+             it++, n++) {
+          const state &centre = *it;
+
+          left._time[n] = right._time[n] = centre.time;
+          left._x[n]                     = centre.config.x();
+          left._y[n]                     = centre.config.y();
+          heading[n]                     = centre.config[2];
+          left._velocity[n]              = centre.kinematics[VELOCITY];
+          left._acceleration[n]          = centre.kinematics[ACCELERATION];
+          curvature[n]                   = centre.curvature;
+          dcurvature[n]                  = centre.dcurvature;
+
+          left._finished = right._finished = centre.finished;
+        }
+        left._size = right._size = n;
+
+        double *sin_h = left._voltage.data(), *cos_h = left._current.data();
+        split_trig(heading, sin_h, cos_h, n);
+
+        split_kinematics(left._x.data(), left._y.data(), sin_h, cos_h, left._velocity.data(),
+                         left._acceleration.data(), right._x.data(), right._y.data(), right._velocity.data(),
+                         right._acceleration.data(), _track_radius, n);
+
+        solve_track_electrical(_trans_left, left);
+        solve_track_electrical(_trans_right, right);
+        return n;
+      }
+
+     private:
+      // Both sides are solved together as 2-lane operations, ordered left, right. With concrete
+      // transmission types the models are inlined, allowing the compiler to vectorize across the sides.
+      void solve_electrical(wheel_state &left, wheel_state &right) const {
+        Eigen::Array2d speed{left.kinematics[VELOCITY], right.kinematics[VELOCITY]};
+        Eigen::Array2d accel{left.kinematics[ACCELERATION], right.kinematics[ACCELERATION]};
+        speed /= _wheel_radius;
+
+        Eigen::Array2d torque = _mass * accel * _wheel_radius;
+
+        // TODO: Make this part of transmission_t
+        Eigen::Array2d free_voltage{_trans_left.get_free_voltage(speed[0]),
+                                    _trans_right.get_free_voltage(speed[1])};
+        Eigen::Array2d current{_trans_left.get_torque_current(torque[0]),
+                               _trans_right.get_torque_current(torque[1])};
+        Eigen::Array2d current_voltage{_trans_left.get_current_voltage(current[0]),
+                                       _trans_right.get_current_voltage(current[1])};
+
+        Eigen::Array2d total_voltage = free_voltage + current_voltage;
+
+        left.voltage  = total_voltage[0];
+        left.current  = current[0];
+        right.voltage = total_voltage[1];
+        right.current = current[1];
+      }
+
+      // Split passes. These take the columns as restrict parameters (not members) so the compiler knows
+      // the columns do not alias, allowing it to vectorize each loop.
+      static void split_trig(const double *__restrict heading, double *__restrict sin_h,
+                             double *__restrict cos_h, const size_t n) {
+        // Separate loops, as the compiler would otherwise fuse these into sincos, which has no vector
+        // variant. With -ffast-math, glibc provides vector variants of sin and cos (libmvec).
+        for (size_t i = 0; i < n; i++) sin_h[i] = sin(heading[i]);
+        for (size_t i = 0; i < n; i++) cos_h[i] = cos(heading[i]);
+      }
+
+      // In: centre position (left_x, left_y), linear velocity and acceleration (left_vel, left_acc),
+      // curvature (right_vel) and change in curvature (right_acc). Out: all left and right columns.
+      static void split_kinematics(double *__restrict left_x, double *__restrict left_y,
+                                   const double *__restrict sin_h, const double *__restrict cos_h,
+                                   double *__restrict left_vel, double *__restrict left_acc,
+                                   double *__restrict right_x, double *__restrict right_y,
+                                   double *__restrict right_vel, double *__restrict right_acc,
+                                   const double track_radius, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+          double x = left_x[i], y = left_y[i];
+          double v = left_vel[i], a = left_acc[i];
+          double k = right_vel[i], dk = right_acc[i];
+
+          // Wheel offset (0, r), rotated by the heading. See split(const state) const
+          double offset_x = -sin_h[i] * track_radius;
+          double offset_y = cos_h[i] * track_radius;
+
+          left_x[i]  = x + offset_x;
+          left_y[i]  = y + offset_y;
+          right_x[i] = x - offset_x;
+          right_y[i] = y - offset_y;
+
+          double v_differential = v * k * track_radius;
+          left_vel[i]           = v - v_differential;
+          right_vel[i]          = v + v_differential;
+
+          double a_differential = (a * k + v * v * dk) * track_radius;
+          left_acc[i]           = a - a_differential;
+          right_acc[i]          = a + a_differential;
+        }
+      }
+
+      static void split_loads(const double *__restrict velocity, const double *__restrict acceleration,
+                              double *__restrict speed, double *__restrict torque, const double wheel_radius,
+                              const double mass, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+          speed[i]  = velocity[i] / wheel_radius;
+          torque[i] = mass * acceleration[i] * wheel_radius;
+        }
+      }
+
+      template <typename transmission_t>
+      void solve_track_electrical(const transmission_t &transmission, wheel_track &track) const {
+        double *voltage = track._voltage.data(), *current = track._current.data();
+
+        // Solved in-place, speed -> voltage and torque -> current.
+        split_loads(track._velocity.data(), track._acceleration.data(), voltage, current, _wheel_radius,
+                    _mass, track._size);
+        transmission.solve_electrical(voltage, current, voltage, current, track._size);
+      }
+
+      double _mass, _track_radius, _wheel_radius;
+      // TODO: Not reference
+      transmission_left_t & _trans_left;
+      transmission_right_t &_trans_right;
+    };
+
+    /**
+     * Coupled chassis with polymorphic transmissions. See @ref basic_chassis.
+     */
+    using chassis = basic_chassis<transmission::dc_transmission, transmission::dc_transmission>;
+  }  // namespace coupled
+}  // namespace pf
 }  // namespace grpl
\ No newline at end of file
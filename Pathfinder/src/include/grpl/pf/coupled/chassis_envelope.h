@@ -0,0 +1,282 @@
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/constants.h"
+#include "state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Precomputed limit envelope of a coupled chassis.
+     *
+     * The envelope is a drop-in replacement for the limits of a @ref chassis, providing
+     * @ref linear_vel_limit(const configuration_state &, double) const and
+     * @ref acceleration_limits(const configuration_state &, double, double) const from lookup tables
+     * instead of evaluating the transmission models (and their virtual calls) on every call. It may be
+     * passed to @ref causal_trajectory_generator or @ref noncausal_trajectory_generator in place of the
+     * chassis.
+     *
+     * The velocity limit is tabulated against curvature, mapped onto the bounded axis
+     * s = rk / (1 + |rk|) (where r is the track radius) such that the whole range of curvature, including
+     * point turns, is covered by a finite table. The acceleration limits of the chassis are the mean of the
+     * acceleration each side can provide at its wheel speed, so the forward and reverse acceleration of
+     * each side is tabulated against wheel speed. All tables use linear interpolation. Wheel speeds beyond
+     * the table (well beyond the free speed of the transmission) fall back to the exact chassis model.
+     *
+     * Tables are refined on construction until the interpolation error, measured against the exact
+     * chassis model between each pair of table entries, is within the requested tolerance (or the
+     * maximum table size is reached, see @ref max_error() const).
+     *
+     * The envelope holds a reference to the chassis, and does not observe changes to the chassis or its
+     * transmissions. Call @ref update() after changing parameters to rebuild the tables if required.
+     *
+     * The envelope is templated on the chassis type (see @ref basic_chassis). @ref chassis_envelope is the
+     * envelope of @ref chassis.
+     */
+    template <typename chassis_type>
+    class basic_chassis_envelope {
+     public:
+      using chassis_t = chassis_type;
+
+      /**
+       * Construct and build a limit envelope for a chassis.
+       *
+       * @param chassis   The chassis to build the envelope of, held internally as a reference.
+       * @param tolerance The maximum acceptable interpolation error, in metres per second (ms^-1) for the
+       *                  velocity limit and metres per second per second (ms^-2) for the acceleration
+       *                  limits.
+       */
+      basic_chassis_envelope(const chassis_t &chassis, double tolerance = 1e-3)
+          : _chassis(chassis), _tolerance(tolerance) {
+        rebuild();
+      }
+
+      /**
+       * @return Reference to the chassis this envelope represents.
+       */
+      const chassis_t &get_chassis() const { return _chassis; }
+
+      /**
+       * @return The maximum interpolation error of the tables, as measured when they were last built.
+       *         This will be within the tolerance, unless the maximum table size was reached.
+       */
+      double max_error() const { return _max_error; }
+
+      /**
+       * Check whether the chassis parameters have changed since the tables were last built.
+       *
+       * Transmissions are compared by their nominal voltage, free speed, current and torque response, so
+       * this does incur several (virtual) transmission calls. It is intended to be called infrequently,
+       * not on every generation step.
+       *
+       * @return True if the tables no longer represent the chassis.
+       */
+      bool stale() const { return fingerprint() != _fingerprint; }
+
+      /**
+       * Rebuild the tables if the chassis parameters have changed. See @ref stale() const.
+       *
+       * @return True if the tables were rebuilt.
+       */
+      bool update() {
+        if (!stale()) return false;
+        rebuild();
+        return true;
+      }
+
+      /**
+       * Rebuild the tables unconditionally.
+       */
+      void rebuild() {
+        const typename chassis_t::transmission_left_t & left  = _chassis.transmission_left();
+        const typename chassis_t::transmission_right_t &right = _chassis.transmission_right();
+
+        _fingerprint = fingerprint();
+        _max_error   = 0;
+
+        size_t n = min_entries;
+        double err;
+        do {
+          build_vel(n);
+          err = vel_error();
+          n   = 2 * n - 1;
+        } while (err > _tolerance && n <= max_entries);
+        _max_error = std::max(_max_error, err);
+
+        // Tabulate wheel speeds well beyond the free speed, as the causal generator may exceed the velocity
+        // limit when curvature increases.
+        double max_speed = 2 * std::max(left.get_free_speed(left.nominal_voltage()),
+                                        right.get_free_speed(right.nominal_voltage()));
+        _speed_scale     = 1.0 / max_speed;
+
+        _max_error = std::max(_max_error, build_side(left, _acc_left));
+        _max_error = std::max(_max_error, build_side(right, _acc_right));
+      }
+
+      /**
+       * Interpolated equivalent of @ref chassis::linear_vel_limit(const configuration_state &, double) const
+       *
+       * @param config    The configuration of the chassis
+       * @param curvature The instantaneous curvature, in metres^-1, expected of the chassis.
+       *
+       * @return  The absolute linear (translational) velocity limit in metres per second (ms^-1).
+       */
+      double linear_vel_limit(const configuration_state &config, double curvature) const {
+        if (std::abs(curvature) > constants::almost_inf) return 0;
+
+        double rk = _chassis.track_radius() * curvature;
+        return lerp(_vel_table, rk / (1 + std::abs(rk)));
+      }
+
+      /**
+       * Interpolated equivalent of
+       * @ref chassis::acceleration_limits(const configuration_state &, double, double) const
+       *
+       * @param config    The configuration of the chassis
+       * @param curvature The instantaneous curvature, in metres^-1, expected of the chassis.
+       * @param velocity  The current linear velocity of the chassis, in metres per second (ms^-1).
+       *
+       * @return  A pair, ordered [min, max], of the linear acceleration limits, in metres per second
+       *          per second (ms^-2).
+       */
+      std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
+                                                    double velocity) const {
+        double differential = velocity * curvature * _chassis.track_radius();
+        // Normalized wheel speeds, in the range [-1, 1] for the extent of the tables.
+        double right = (velocity + differential) / _chassis.wheel_radius() * _speed_scale;
+        double left  = (velocity - differential) / _chassis.wheel_radius() * _speed_scale;
+
+        if (!(std::abs(right) <= 1 && std::abs(left) <= 1))
+          return _chassis.acceleration_limits(config, curvature, velocity);
+
+        std::pair<double, double> r = lerp_pair(_acc_right, right), l = lerp_pair(_acc_left, left);
+        return std::pair<double, double>{(r.first + l.first) / 2.0, (r.second + l.second) / 2.0};
+      }
+
+      /**
+       * Split a centre state into the left and right transmission state components. See
+       * @ref chassis::split(const state) const.
+       *
+       * @return  A pair, ordered [left, right], of @ref wheel_state.
+       */
+      std::pair<wheel_state, wheel_state> split(const state centre) const { return _chassis.split(centre); }
+
+     private:
+      static constexpr size_t min_entries = 17;
+      static constexpr size_t max_entries = 16385;
+
+      using fingerprint_t = Eigen::Matrix<double, 13, 1>;
+
+      fingerprint_t fingerprint() const {
+        const typename chassis_t::transmission_left_t & l = _chassis.transmission_left();
+        const typename chassis_t::transmission_right_t &r = _chassis.transmission_right();
+
+        double vl = l.nominal_voltage(), vr = r.nominal_voltage();
+
+        fingerprint_t fp;
+        fp << _chassis.mass(), _chassis.wheel_radius(), _chassis.track_radius(), vl, l.get_free_speed(vl),
+            l.get_current(vl, 0), l.get_current(vl, 1), l.get_torque(1), vr, r.get_free_speed(vr),
+            r.get_current(vr, 0), r.get_current(vr, 1), r.get_torque(1);
+        return fp;
+      }
+
+      // Table axes are uniform over [-1, 1].
+      static double axis(size_t i, size_t n) { return -1 + 2.0 * i / (n - 1); }
+
+      static double lerp(const std::vector<double> &table, double x) {
+        double f = (x + 1) * 0.5 * (table.size() - 1);
+        size_t i = std::min(static_cast<size_t>(f), table.size() - 2);
+        f -= i;
+        return table[i] + f * (table[i + 1] - table[i]);
+      }
+
+      // As above, for a table of interleaved [min, max] pairs.
+      static std::pair<double, double> lerp_pair(const std::vector<double> &table, double x) {
+        size_t n = table.size() / 2;
+        double f = (x + 1) * 0.5 * (n - 1);
+        size_t i = std::min(static_cast<size_t>(f), n - 2);
+        f -= i;
+
+        const double *p = &table[2 * i];
+        return std::pair<double, double>{p[0] + f * (p[2] - p[0]), p[1] + f * (p[3] - p[1])};
+      }
+
+      double exact_vel(double s) const {
+        if (std::abs(s) >= 1) return 0;
+        return _chassis.linear_vel_limit(configuration_state::Zero(),
+                                         s / ((1 - std::abs(s)) * _chassis.track_radius()));
+      }
+
+      // The [reverse, forward] acceleration that one side contributes at a normalized wheel speed. See
+      // chassis::acceleration_limits.
+      template <typename transmission_t>
+      std::pair<double, double> exact_side(const transmission_t &trans, double x) const {
+        double current = trans.get_current(trans.nominal_voltage(), x / _speed_scale);
+        double scale   = 1.0 / (_chassis.mass() * _chassis.wheel_radius());
+        return std::pair<double, double>{trans.get_torque(-current) * scale, trans.get_torque(current) * scale};
+      }
+
+      void build_vel(size_t n) {
+        _vel_table.resize(n);
+        for (size_t i = 0; i < n; i++) _vel_table[i] = exact_vel(axis(i, n));
+      }
+
+      // Error at the midpoint of each pair of table entries, which is where linear interpolation is
+      // furthest from the tabulated points.
+      double vel_error() const {
+        size_t n   = _vel_table.size();
+        double err = 0;
+        for (size_t i = 0; i + 1 < n; i++) {
+          double s = 0.5 * (axis(i, n) + axis(i + 1, n));
+          err      = std::max(err, std::abs(lerp(_vel_table, s) - exact_vel(s)));
+        }
+        return err;
+      }
+
+      template <typename transmission_t>
+      double build_side(const transmission_t &trans, std::vector<double> &table) const {
+        size_t n = min_entries;
+        double err;
+        do {
+          table.resize(2 * n);
+          for (size_t i = 0; i < n; i++) {
+            std::pair<double, double> acc = exact_side(trans, axis(i, n));
+            table[2 * i]                  = acc.first;
+            table[2 * i + 1]              = acc.second;
+          }
+
+          err = 0;
+          for (size_t i = 0; i + 1 < n; i++) {
+            double                    x     = 0.5 * (axis(i, n) + axis(i + 1, n));
+            std::pair<double, double> exact = exact_side(trans, x), lut = lerp_pair(table, x);
+            err = std::max(err, std::max(std::abs(exact.first - lut.first), std::abs(exact.second - lut.second)));
+          }
+          n = 2 * n - 1;
+        } while (err > _tolerance && n <= max_entries);
+        return err;
+      }
+
+      const chassis_t &_chassis;
+      double           _tolerance;
+      double           _max_error   = 0;
+      double           _speed_scale = 0;
+      fingerprint_t    _fingerprint;
+
+      std::vector<double> _vel_table;
+      // Interleaved [min, max] acceleration pairs for each side, indexed by normalized wheel speed.
+      std::vector<double> _acc_left, _acc_right;
+    };
+
+    /**
+     * Limit envelope of a coupled chassis with polymorphic transmissions. See @ref basic_chassis_envelope.
+     */
+    using chassis_envelope = basic_chassis_envelope<chassis>;
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "chassis.h"
+#include "constraints.h"
+#include "state.h"
+
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * A chassis with additional constraints on its motion, composed at compile time.
+     *
+     * The constrained chassis is a drop-in replacement for the limits of a chassis, providing
+     * @ref linear_vel_limit(const configuration_state &, double) const and
+     * @ref acceleration_limits(const configuration_state &, double, double) const as the intersection of
+     * the limits of the chassis and the limits of each constraint: the minimum of the velocity limits, and
+     * the tightest of the acceleration limits. It may be passed to any trajectory generator in place of the
+     * chassis.
+     *
+     * The constraints are given as a list of template parameters and held by value, such that the
+     * intersection is unrolled at compile time without virtual calls. The chassis may be any type providing
+     * the limits of a chassis, such as @ref basic_chassis or @ref basic_chassis_envelope. Available
+     * constraints include @ref centripetal_constraint, @ref current_constraint and
+     * @ref voltage_constraint. See constraints.h for the interface of a constraint.
+     *
+     * Use @ref make_constrained_chassis to deduce the template parameters.
+     *
+     * @param chassis_type     The type of the chassis.
+     * @param constraint_types The types of the constraints.
+     */
+    template <typename chassis_type, typename... constraint_types>
+    class constrained_chassis {
+     public:
+      using chassis_t     = chassis_type;
+      using constraints_t = std::tuple<constraint_types...>;
+
+      /**
+       * Construct a constrained chassis.
+       *
+       * @param chassis     The chassis, held internally as a reference.
+       * @param constraints The constraints, held internally as copies.
+       */
+      constrained_chassis(const chassis_t &chassis, const constraint_types &... constraints)
+          : _chassis(chassis), _constraints(constraints...) {}
+
+      /**
+       * @return Reference to the unconstrained chassis.
+       */
+      const chassis_t &get_chassis() const { return _chassis; }
+
+      /**
+       * @param I The index of the constraint, in the order of the template parameters.
+       * @return  Reference to the constraint, which may be modified between generation steps.
+       */
+      template <size_t I>
+      typename std::tuple_element<I, constraints_t>::type &constraint() {
+        return std::get<I>(_constraints);
+      }
+
+      /**
+       * @param I The index of the constraint, in the order of the template parameters.
+       * @return  Reference to the constraint.
+       */
+      template <size_t I>
+      const typename std::tuple_element<I, constraints_t>::type &constraint() const {
+        return std::get<I>(_constraints);
+      }
+
+      /**
+       * Calculate the absolute linear velocity limit of the chassis, in metres per second (ms^-1), as the
+       * minimum of the limit of the chassis and of each constraint.
+       *
+       * See @ref basic_chassis::linear_vel_limit(const configuration_state &, double) const
+       */
+      double linear_vel_limit(const configuration_state &config, double curvature) const {
+        return intersect_velocity<0>(config, curvature, _chassis.linear_vel_limit(config, curvature));
+      }
+
+      /**
+       * Calculate the minimum and maximum linear acceleration limits of the chassis, in metres per second
+       * per second (ms^-2), as the intersection of the limits of the chassis and of each constraint.
+       *
+       * See @ref basic_chassis::acceleration_limits(const configuration_state &, double, double) const
+       */
+      std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
+                                                    double velocity) const {
+        return intersect_acceleration<0>(config, curvature, velocity,
+                                         _chassis.acceleration_limits(config, curvature, velocity));
+      }
+
+     private:
+      static constexpr size_t count = sizeof...(constraint_types);
+
+      template <size_t I>
+      typename std::enable_if<(I < count), double>::type intersect_velocity(
+          const configuration_state &config, double curvature, double limit) const {
+        double constraint = std::get<I>(_constraints).velocity_limit(config, curvature);
+        return intersect_velocity<I + 1>(config, curvature, std::min(limit, constraint));
+      }
+
+      template <size_t I>
+      typename std::enable_if<(I == count), double>::type intersect_velocity(
+          const configuration_state &, double, double limit) const {
+        return limit;
+      }
+
+      template <size_t I>
+      typename std::enable_if<(I < count), std::pair<double, double>>::type intersect_acceleration(
+          const configuration_state &config, double curvature, double velocity,
+          std::pair<double, double> limits) const {
+        std::pair<double, double> constraint =
+            std::get<I>(_constraints).acceleration_limits(config, curvature, velocity);
+        limits.first  = std::max(limits.first, constraint.first);
+        limits.second = std::min(limits.second, constraint.second);
+        return intersect_acceleration<I + 1>(config, curvature, velocity, limits);
+      }
+
+      template <size_t I>
+      typename std::enable_if<(I == count), std::pair<double, double>>::type intersect_acceleration(
+          const configuration_state &, double, double, std::pair<double, double> limits) const {
+        return limits;
+      }
+
+      const chassis_t &_chassis;
+      constraints_t    _constraints;
+    };
+
+    /**
+     * Construct a @ref constrained_chassis, deducing its template parameters.
+     *
+     * @param chassis     The chassis, held internally as a reference.
+     * @param constraints The constraints, held internally as copies.
+     */
+    template <typename chassis_t, typename... constraint_types>
+    constrained_chassis<chassis_t, constraint_types...> make_constrained_chassis(
+        const chassis_t &chassis, const constraint_types &... constraints) {
+      return constrained_chassis<chassis_t, constraint_types...>(chassis, constraints...);
+    }
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
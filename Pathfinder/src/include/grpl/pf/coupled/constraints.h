@@ -0,0 +1,196 @@
+#pragma once
+
+#include "grpl/pf/constants.h"
+#include "state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+    /*
+     * Constraints on the motion of a coupled chassis, in addition to the limits of the chassis itself.
+     * Constraints are composed with a chassis at compile time by constrained_chassis.
+     *
+     * A constraint is any type providing the limits of a chassis, mirroring
+     * basic_chassis::linear_vel_limit and basic_chassis::acceleration_limits:
+     *
+     *    double velocity_limit(const configuration_state &config, double curvature) const;
+     *    std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
+     *                                                  double velocity) const;
+     *
+     * A constraint that does not limit a term returns an infinite limit for it.
+     */
+
+    //! An unbounded limit, for constraints that do not limit a term.
+    constexpr double unconstrained = std::numeric_limits<double>::infinity();
+
+    namespace detail {
+      // Mean acceleration limits of the chassis given the voltage of each side, with the current of each
+      // side clamped to a limit. Mirrors basic_chassis::acceleration_limits.
+      template <typename chassis_t>
+      std::pair<double, double> clamped_acceleration_limits(const chassis_t &chassis, double curvature,
+                                                            double velocity, double voltage_left,
+                                                            double voltage_right, double current_limit) {
+        double differential = velocity * curvature * chassis.track_radius();
+        double wheel_left   = (velocity - differential) / chassis.wheel_radius();
+        double wheel_right  = (velocity + differential) / chassis.wheel_radius();
+
+        const auto &left  = chassis.transmission_left();
+        const auto &right = chassis.transmission_right();
+
+        double current_left  = left.get_current(voltage_left, wheel_left);
+        double current_right = right.get_current(voltage_right, wheel_right);
+        current_left         = std::max(-current_limit, std::min(current_limit, current_left));
+        current_right        = std::max(-current_limit, std::min(current_limit, current_right));
+
+        double scale = 0.5 / (chassis.mass() * chassis.wheel_radius());
+        double max   = (left.get_torque(current_left) + right.get_torque(current_right)) * scale;
+        double min   = (left.get_torque(-current_left) + right.get_torque(-current_right)) * scale;
+        return std::pair<double, double>{min, max};
+      }
+    }  // namespace detail
+
+    /**
+     * Centripetal acceleration constraint, limiting the velocity in corners to prevent the chassis from
+     * sliding or tipping.
+     *
+     * The centripetal acceleration of the chassis is a_c = v^2 * k, so the velocity is limited to
+     * sqrt(a_c / |k|). The linear acceleration is not limited.
+     *
+     * See @ref constrained_chassis
+     */
+    class centripetal_constraint {
+     public:
+      /**
+       * @param max_acceleration The maximum centripetal acceleration, in metres per second per second
+       *                         (ms^-2).
+       */
+      explicit centripetal_constraint(double max_acceleration) : _max(std::abs(max_acceleration)) {}
+
+      /**
+       * @return The maximum centripetal acceleration, in metres per second per second (ms^-2).
+       */
+      double max_acceleration() const { return _max; }
+
+      double velocity_limit(const configuration_state &config, double curvature) const {
+        double k = std::abs(curvature);
+        return k < constants::epsilon ? unconstrained : std::sqrt(_max / k);
+      }
+
+      std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
+                                                    double velocity) const {
+        return std::pair<double, double>{-unconstrained, unconstrained};
+      }
+
+     private:
+      double _max;
+    };
+
+    /**
+     * Current constraint, limiting the current drawn by each side of the chassis, such as by the current
+     * limit of a motor controller or to prevent tripping a breaker.
+     *
+     * The acceleration is limited to the torque each side can provide without drawing more than the limit.
+     * The velocity is not limited. This is equivalent to a chassis with each transmission wrapped in a
+     * @ref grpl::pf::transmission::current_limited, without rebuilding the chassis.
+     *
+     * See @ref constrained_chassis
+     *
+     * @param chassis_t The type of chassis, see @ref basic_chassis.
+     */
+    template <typename chassis_t>
+    class current_constraint {
+     public:
+      /**
+       * @param chassis       The chassis, held internally as a reference.
+       * @param current_limit The maximum absolute current drawn by each side, in Amps.
+       */
+      current_constraint(const chassis_t &chassis, double current_limit)
+          : _chassis(chassis), _limit(std::abs(current_limit)) {}
+
+      /**
+       * @return The maximum absolute current drawn by each side, in Amps.
+       */
+      double current_limit() const { return _limit; }
+
+      /**
+       * @param current_limit The maximum absolute current drawn by each side, in Amps.
+       */
+      void set_current_limit(double current_limit) { _limit = std::abs(current_limit); }
+
+      double velocity_limit(const configuration_state &config, double curvature) const {
+        return unconstrained;
+      }
+
+      std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
+                                                    double velocity) const {
+        return detail::clamped_acceleration_limits(_chassis, curvature, velocity,
+                                                   _chassis.transmission_left().nominal_voltage(),
+                                                   _chassis.transmission_right().nominal_voltage(), _limit);
+      }
+
+     private:
+      const chassis_t &_chassis;
+      double           _limit;
+    };
+
+    /**
+     * Battery voltage constraint, limiting the chassis to the voltage available from the battery when it
+     * is below the nominal voltage of the transmissions (e.g. a partially discharged or sagging battery).
+     *
+     * The velocity is limited such that neither wheel exceeds the free speed of its transmission at the
+     * available voltage, and the acceleration is limited to the torque each side can provide at the
+     * available voltage.
+     *
+     * See @ref constrained_chassis
+     *
+     * @param chassis_t The type of chassis, see @ref basic_chassis.
+     */
+    template <typename chassis_t>
+    class voltage_constraint {
+     public:
+      /**
+       * @param chassis The chassis, held internally as a reference.
+       * @param voltage The voltage available to the transmissions, in Volts.
+       */
+      voltage_constraint(const chassis_t &chassis, double voltage) : _chassis(chassis) {
+        set_voltage(voltage);
+      }
+
+      /**
+       * @return The voltage available to the transmissions, in Volts.
+       */
+      double voltage() const { return _voltage; }
+
+      /**
+       * @param voltage The voltage available to the transmissions, in Volts.
+       */
+      void set_voltage(double voltage) {
+        _voltage   = std::abs(voltage);
+        _max_left  = _chassis.transmission_left().get_free_speed(_voltage) * _chassis.wheel_radius();
+        _max_right = _chassis.transmission_right().get_free_speed(_voltage) * _chassis.wheel_radius();
+      }
+
+      double velocity_limit(const configuration_state &config, double curvature) const {
+        // v_l = v(1 - rk), v_r = v(1 + rk). See basic_chassis::linear_vel_limit
+        double rk = _chassis.track_radius() * curvature;
+        return std::min(_max_left / std::abs(1 - rk), _max_right / std::abs(1 + rk));
+      }
+
+      std::pair<double, double> acceleration_limits(const configuration_state &config, double curvature,
+                                                    double velocity) const {
+        return detail::clamped_acceleration_limits(_chassis, curvature, velocity, _voltage, _voltage,
+                                                   unconstrained);
+      }
+
+     private:
+      const chassis_t &_chassis;
+      double           _voltage, _max_left, _max_right;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/path/curve.h"
+#include "state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Non-causal velocity plan over a path, recalculated incrementally as the path changes.
+     *
+     * The plan produces the same trajectory as @ref noncausal_trajectory_generator (sampled at a fixed
+     * distance, with a forward pass limited by acceleration and a reverse pass limited by deceleration),
+     * but keeps the trajectory and the result of the forward pass between updates. When the path changes
+     * only from some distance onward (see @ref grpl::pf::path::incremental_path::update()), the samples
+     * and the forward pass are only recalculated from that distance onward, as the forward pass at each
+     * sample depends only on the samples before it. The reverse pass runs from the end of the path back
+     * past the changed distance, stopping as soon as it reaches a sample whose velocity is unchanged. Time
+     * points are then reassigned from the first changed velocity onward.
+     *
+     * The storage for the plan grows with the path, and is kept between updates.
+     */
+    template <typename chassis_type = chassis>
+    class incremental_velocity_plan {
+     public:
+      using chassis_t   = chassis_type;
+      using container_t = std::vector<state>;
+      using iterator_t  = typename container_t::const_iterator;
+
+      /**
+       * Create an empty velocity plan.
+       *
+       * @param chassis         The chassis to plan with, held internally as a reference.
+       * @param sample_distance The distance between two consecutive states along the path, in metres. See
+       *                        @ref noncausal_trajectory_generator::configure(double)
+       */
+      incremental_velocity_plan(const chassis_t &chassis, double sample_distance)
+          : _chassis(chassis), _sample_distance(sample_distance) {}
+
+      /**
+       * Update the plan for a changed path.
+       *
+       * @param curve_begin   Iterator pointing to the start of the curve collection.
+       * @param curve_end     Iterator pointing to the end of the curve collection.
+       * @param from_distance The distance along the path, in metres, from which the path has changed since
+       *                      the last update. Everything before this distance must be unchanged. Use 0 to
+       *                      recalculate the whole plan.
+       * @return              The number of states recalculated.
+       */
+      template <typename iterator_curve_t>
+      size_t update(const iterator_curve_t curve_begin, const iterator_curve_t curve_end,
+                    double from_distance = 0) {
+        size_t old_count = _states.size();
+
+        if (curve_begin == curve_end) {
+          _states.clear();
+          _forward.clear();
+          return 0;
+        }
+
+        double length = total_length(curve_begin, curve_end);
+        size_t count  = state_count(length);
+
+        // The first sample at or before the change. The old last sample lies at the old end of the path,
+        // which may not be on the sample grid, so is always recalculated.
+        size_t first = 0;
+        if (old_count > 0) {
+          first = static_cast<size_t>(std::max(0.0, from_distance) / _sample_distance);
+          first = std::min(first, std::min(count, old_count) - 1);
+        }
+
+        _states.resize(count);
+        _forward.resize(count);
+
+        sample(curve_begin, curve_end, length, first);
+
+        // Forward pass, limited by maximum acceleration. We start from rest.
+        if (first == 0) _forward[0] = 0;
+        for (size_t i = std::max<size_t>(first, 1); i < count; i++) {
+          const state &last = _states[i - 1];
+
+          double ds    = _states[i].kinematics[POSITION] - last.kinematics[POSITION];
+          double v     = _forward[i - 1];
+          double accel = _chassis.acceleration_limits(last.config, last.curvature, v).second;
+
+          // v^2 = u^2 + 2as
+          double v_reachable = sqrt(std::max(0.0, v * v + 2 * std::max(0.0, accel) * ds));
+          _forward[i]        = std::min(v_reachable, _states[i].kinematics[VELOCITY]);
+        }
+
+        // Reverse pass, limited by maximum deceleration. We end at rest.
+        size_t changed = first;
+
+        _states[count - 1].kinematics[VELOCITY] = 0;
+        for (size_t i = count - 1; i > 0; i--) {
+          state &st = _states[i], &prev = _states[i - 1];
+
+          double ds    = st.kinematics[POSITION] - prev.kinematics[POSITION];
+          double v     = st.kinematics[VELOCITY];
+          double decel = _chassis.acceleration_limits(st.config, st.curvature, v).first;
+
+          double v_reachable = sqrt(std::max(0.0, v * v - 2 * std::min(0.0, decel) * ds));
+          double v_prev      = std::min(v_reachable, _forward[i - 1]);
+
+          // Before the change, the reverse pass from here onward is identical to the last update.
+          if (i - 1 < first && v_prev == prev.kinematics[VELOCITY]) break;
+
+          prev.kinematics[VELOCITY] = v_prev;
+          changed                   = std::min(changed, i - 1);
+        }
+
+        // Assign time and acceleration to each interval, assuming constant acceleration over the
+        // interval.
+        for (size_t i = std::max<size_t>(changed, 1); i < count; i++) {
+          state &last = _states[i - 1], &st = _states[i];
+
+          double ds  = st.kinematics[POSITION] - last.kinematics[POSITION];
+          double u   = last.kinematics[VELOCITY];
+          double v   = st.kinematics[VELOCITY];
+          double dt  = (u + v) > constants::epsilon ? 2 * ds / (u + v) : 0;
+          double acc = ds > constants::epsilon ? (v * v - u * u) / (2 * ds) : 0;
+
+          st.time                     = last.time + dt;
+          st.kinematics[ACCELERATION] = acc;
+        }
+
+        _states[count - 1].finished = true;
+        return count - changed;
+      }
+
+      /**
+       * @return The distance between two consecutive states along the path, in metres.
+       */
+      double sample_distance() const { return _sample_distance; }
+
+      /**
+       * @return The number of states in the plan.
+       */
+      size_t size() const { return _states.size(); }
+
+      /**
+       * @param idx The index of the state.
+       * @return    The state at the given index.
+       */
+      const state &operator[](size_t idx) const { return _states[idx]; }
+
+      /**
+       * @return Iterator to the first state of the plan.
+       */
+      iterator_t begin() const { return _states.begin(); }
+
+      /**
+       * @return Iterator to the end of the states of the plan.
+       */
+      iterator_t end() const { return _states.end(); }
+
+     private:
+      // Sample the path from sample first onward, applying the velocity limit to each sample. The search
+      // for the curve containing each sample starts from the beginning of the path, such that the
+      // distances (and therefore samples) are identical to those of a full update.
+      template <typename iterator_curve_t>
+      void sample(const iterator_curve_t curve_begin, const iterator_curve_t curve_end, double length,
+                  size_t first) {
+        size_t           count       = _states.size();
+        iterator_curve_t curve       = curve_begin;
+        double           curve_start = 0;
+
+        for (size_t i = 0; i < count; i++) {
+          double distance = (i == count - 1) ? length : i * _sample_distance;
+
+          iterator_curve_t next = curve;
+          while (++next != curve_end && curve_start + curve_length(curve) < distance) {
+            curve_start += curve_length(curve);
+            curve = next;
+          }
+
+          if (i < first) continue;
+
+          double          curve_distance = distance - curve_start;
+          path::curve<2> &c              = *curve;
+
+          auto centre     = c.position(curve_distance);
+          auto centre_rot = c.rotation(curve_distance);
+
+          state &st     = _states[i];
+          st.time       = 0;
+          st.config     = configuration_state{centre.x(), centre.y(), atan2(centre_rot.y(), centre_rot.x())};
+          st.curvature  = c.curvature(curve_distance);
+          st.dcurvature = c.dcurvature(curve_distance);
+          st.kinematics = kinematic_state{distance, _chassis.linear_vel_limit(st.config, st.curvature), 0};
+          st.finished   = false;
+        }
+      }
+
+      template <typename iterator_curve_t>
+      static inline double curve_length(const iterator_curve_t it) {
+        path::curve<2> &curve = *it;
+        return curve.length();
+      }
+
+      template <typename iterator_curve_t>
+      static inline double total_length(const iterator_curve_t curve_begin,
+                                        const iterator_curve_t curve_end) {
+        double length = 0;
+        for (iterator_curve_t it = curve_begin; it != curve_end; it++) length += curve_length(it);
+        return length;
+      }
+
+      size_t state_count(double total_length) const {
+        size_t intervals = static_cast<size_t>(ceil(total_length / _sample_distance - constants::epsilon));
+        return (intervals < 1 ? 1 : intervals) + 1;
+      }
+
+      const chassis_t &   _chassis;
+      double              _sample_distance;
+      container_t         _states;
+      std::vector<double> _forward;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
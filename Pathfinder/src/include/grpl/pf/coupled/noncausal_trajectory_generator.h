@@ -0,0 +1,188 @@
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/path/curve.h"
+#include "state.h"
+
+#include <cmath>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Non-causal (offline) trajectory generator, given the chassis and path.
+     *
+     * This generator is the counterpart of @ref causal_trajectory_generator. Instead of generating a
+     * single state with knowledge only of the current state, the non-causal generator has knowledge of
+     * the entire path, and generates the full trajectory up front into a caller-provided buffer.
+     *
+     * The path is sampled at a fixed distance interval. At each sample, the velocity is limited by
+     * @ref chassis::linear_vel_limit(const configuration_state &, double) const. A forward pass then limits
+     * the velocity by the maximum acceleration of the chassis, and a reverse pass limits the velocity by
+     * the deceleration of the chassis, such that the trajectory always comes to rest exactly at the end of
+     * the path. Finally, each sample is assigned a time point from its velocity.
+     *
+     * It is recommended to use this generator when the path is known ahead of time. Generating once and
+     * then sampling is much cheaper per control loop iteration than calling the causal generator, and the
+     * trajectory reaches the goal exactly, with no sudden decelerations at the end of the path.
+     *
+     * As with the profiles, the acceleration of each state is the acceleration applied over the interval
+     * ending at that state.
+     */
+    class noncausal_trajectory_generator {
+     public:
+      noncausal_trajectory_generator() {}
+
+      /**
+       * Configure the distance between samples of the path.
+       *
+       * @param sample_distance The distance between two consecutive states along the path, in metres. The
+       *                        last interval may be shorter, such that the last state lies at the end of
+       *                        the path.
+       */
+      void configure(double sample_distance) { _sample_distance = sample_distance; }
+
+      /**
+       * @return The distance between two consecutive states along the path, in metres.
+       */
+      double sample_distance() const { return _sample_distance; }
+
+      /**
+       * Calculate the number of states required to hold the trajectory for a given path, with the values
+       * set in @ref configure(double).
+       *
+       * @param curve_begin   Iterator pointing to the start of the curve collection.
+       * @param curve_end     Iterator pointing to the end of the curve collection.
+       * @return              The number of states required to hold the trajectory.
+       */
+      template <typename iterator_curve_t>
+      size_t state_count(const iterator_curve_t curve_begin, const iterator_curve_t curve_end) const {
+        return state_count(total_length(curve_begin, curve_end));
+      }
+
+      /**
+       * Generate the full trajectory for a given path.
+       *
+       * @param chassis       The coupled chassis, used to provide limits for the trajectory kinematics. A
+       *                      @ref chassis_envelope of the chassis may be used in its place, to use
+       *                      precomputed limits instead of the exact model.
+       * @param curve_begin   Iterator pointing to the start of the curve collection. See @ref std::iterator.
+       * @param curve_end     Iterator pointing to the end of the curve collection. See @ref std::iterator.
+       * @param state_begin   Iterator to the beginning of the state output container. Must be a random
+       *                      access iterator, as the container is also used as scratch space for the
+       *                      forward and reverse passes.
+       * @param max_states    The maximum size of the state output container.
+       * @return              The number of states generated. If the container is too small to hold the
+       *                      trajectory (see @ref state_count), nothing is generated and 0 is returned.
+       */
+      template <typename iterator_curve_t, typename iterator_state_t, typename chassis_t = chassis>
+      size_t generate(const chassis_t &chassis, const iterator_curve_t curve_begin,
+                      const iterator_curve_t curve_end, iterator_state_t state_begin,
+                      const size_t max_states) const {
+        if (curve_begin == curve_end) return 0;
+
+        double length = total_length(curve_begin, curve_end);
+        size_t count  = state_count(length);
+        if (count > max_states) return 0;
+
+        // Sample the path, and apply the velocity limit to each sample.
+        iterator_curve_t curve       = curve_begin;
+        double           curve_start = 0;
+
+        for (size_t i = 0; i < count; i++) {
+          double distance = (i == count - 1) ? length : i * _sample_distance;
+
+          // Advance to the curve containing the sample. The last curve will also contain any sample
+          // that lands beyond the end of the path by floating point error.
+          iterator_curve_t next = curve;
+          while (++next != curve_end && curve_start + curve_length(curve) < distance) {
+            curve_start += curve_length(curve);
+            curve = next;
+          }
+
+          double          curve_distance = distance - curve_start;
+          path::curve<2> &c              = *curve;
+
+          auto centre     = c.position(curve_distance);
+          auto centre_rot = c.rotation(curve_distance);
+
+          state &st     = state_begin[i];
+          st.time       = 0;
+          st.config     = configuration_state{centre.x(), centre.y(), atan2(centre_rot.y(), centre_rot.x())};
+          st.curvature  = c.curvature(curve_distance);
+          st.dcurvature = c.dcurvature(curve_distance);
+          st.kinematics = kinematic_state{distance, chassis.linear_vel_limit(st.config, st.curvature), 0};
+          st.finished   = false;
+        }
+
+        // Forward pass, limited by maximum acceleration. We start from rest.
+        state_begin[0].kinematics[VELOCITY] = 0;
+        for (size_t i = 1; i < count; i++) {
+          state &last = state_begin[i - 1], &st = state_begin[i];
+
+          double ds    = st.kinematics[POSITION] - last.kinematics[POSITION];
+          double v     = last.kinematics[VELOCITY];
+          double accel = chassis.acceleration_limits(last.config, last.curvature, v).second;
+
+          // v^2 = u^2 + 2as
+          double v_reachable = sqrt(std::max(0.0, v * v + 2 * std::max(0.0, accel) * ds));
+          if (v_reachable < st.kinematics[VELOCITY]) st.kinematics[VELOCITY] = v_reachable;
+        }
+
+        // Reverse pass, limited by maximum deceleration. We end at rest.
+        state_begin[count - 1].kinematics[VELOCITY] = 0;
+        for (size_t i = count - 1; i > 0; i--) {
+          state &st = state_begin[i], &prev = state_begin[i - 1];
+
+          double ds    = st.kinematics[POSITION] - prev.kinematics[POSITION];
+          double v     = st.kinematics[VELOCITY];
+          double decel = chassis.acceleration_limits(st.config, st.curvature, v).first;
+
+          double v_reachable = sqrt(std::max(0.0, v * v - 2 * std::min(0.0, decel) * ds));
+          if (v_reachable < prev.kinematics[VELOCITY]) prev.kinematics[VELOCITY] = v_reachable;
+        }
+
+        // Assign time and acceleration to each interval, assuming constant acceleration over the
+        // interval.
+        for (size_t i = 1; i < count; i++) {
+          state &last = state_begin[i - 1], &st = state_begin[i];
+
+          double ds  = st.kinematics[POSITION] - last.kinematics[POSITION];
+          double u   = last.kinematics[VELOCITY];
+          double v   = st.kinematics[VELOCITY];
+          double dt  = (u + v) > constants::epsilon ? 2 * ds / (u + v) : 0;
+          double acc = ds > constants::epsilon ? (v * v - u * u) / (2 * ds) : 0;
+
+          st.time                     = last.time + dt;
+          st.kinematics[ACCELERATION] = acc;
+        }
+
+        state_begin[count - 1].finished = true;
+        return count;
+      }
+
+     private:
+      template <typename iterator_curve_t>
+      static inline double curve_length(const iterator_curve_t it) {
+        path::curve<2> &curve = *it;
+        return curve.length();
+      }
+
+      template <typename iterator_curve_t>
+      static inline double total_length(const iterator_curve_t curve_begin, const iterator_curve_t curve_end) {
+        double length = 0;
+        for (iterator_curve_t it = curve_begin; it != curve_end; it++) length += curve_length(it);
+        return length;
+      }
+
+      size_t state_count(double total_length) const {
+        size_t intervals = static_cast<size_t>(ceil(total_length / _sample_distance - constants::epsilon));
+        return (intervals < 1 ? 1 : intervals) + 1;
+      }
+
+      double _sample_distance = 0.01;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "causal_trajectory_generator.h"
+#include "grpl/pf/util/cycle_clock.h"
+#include "grpl/pf/util/spsc_ring.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Causal trajectory generator with bounded, allocation-free latency, for use in a hard real-time loop.
+     *
+     * This generator produces the same states as @ref causal_trajectory_generator, but the cost of each
+     * call to @ref generate() does not depend on the position along the path. The curves of the path are
+     * given on construction, where the cumulative length at the end of each curve is calculated once. Each
+     * call then finds the current curve with a binary search over these lengths (O(log n) in the number of
+     * curves), instead of the linear search of @ref causal_trajectory_generator. All storage is allocated on
+     * construction, and @ref generate() does not allocate.
+     *
+     * The cost of the profile is bounded by limiting the number of timeslices per call, with
+     * @ref grpl::pf::profile::profile::set_max_slices(int).
+     *
+     * The latency of each call may be recorded, in cycles of @ref grpl::pf::util::cycle_count(), into a
+     * lock-free ring buffer (see @ref set_latency_ring()) to be drained by a monitoring thread.
+     */
+    class realtime_trajectory_generator {
+     public:
+      /**
+       * A latency sample of a single call to @ref generate().
+       */
+      struct latency_sample {
+        //! The time of the generated state, in seconds.
+        double time;
+        //! The duration of the call, in cycles of @ref grpl::pf::util::cycle_count().
+        uint64_t cycles;
+      };
+
+      using ring_t = util::spsc_ring<latency_sample>;
+
+      /**
+       * Create a real-time trajectory generator over a path.
+       *
+       * @param curve_begin Iterator pointing to the start of the curve collection. See @ref std::iterator.
+       * @param curve_end   Iterator pointing to the end of the curve collection. See @ref std::iterator.
+       *                    The curves are held internally by pointer, and must outlive the generator.
+       */
+      template <typename iterator_curve_t>
+      realtime_trajectory_generator(const iterator_curve_t curve_begin, const iterator_curve_t curve_end) {
+        double total_length = 0;
+        for (iterator_curve_t it = curve_begin; it != curve_end; it++) {
+          path::curve<2> &curr = *it;
+          // Summed in the same order as the search of causal_trajectory_generator, such that the same curve
+          // and curve distance are found for any distance.
+          total_length += curr.length();
+          _curves.push_back(&curr);
+          _curve_end.push_back(total_length);
+        }
+      }
+
+      /**
+       * Generate the next state of the trajectory given the current state. See
+       * @ref causal_trajectory_generator::generate().
+       *
+       * This method does not modify the generator or the profile, and does not allocate.
+       *
+       * @param chassis The coupled chassis, used to provide limits for the trajectory.
+       * @param profile Reference to the profile to use.
+       * @param ctx     The profile context of this trajectory.
+       * @param last    The current ("last") state of the trajectory.
+       * @param time    The time of the next point (last.time + dt), in seconds.
+       */
+      template <typename chassis_t = chassis>
+      state generate(const chassis_t &chassis, const profile::profile &profile,
+                     profile::profile::context &ctx, const state &last, double time) const {
+        uint64_t start = _ring != nullptr ? util::cycle_count() : 0;
+
+        double          curve_distance;
+        path::curve<2> *curve = find_curve(last.kinematics[0], curve_distance);
+
+        double max_velocity = _lookahead != nullptr
+                                  ? causal_trajectory_generator::lookahead_velocity(*_lookahead, last, time)
+                                  : std::numeric_limits<double>::infinity();
+
+        state output = causal_trajectory_generator::generate_at(chassis, curve, curve_distance, length(),
+                                                                profile, ctx, last, time, max_velocity);
+
+        if (_ring != nullptr) _ring->push(latency_sample{time, util::cycle_count() - start});
+        return output;
+      }
+
+      /**
+       * Set the ring buffer to record the latency of each call to @ref generate() into.
+       *
+       * The generator is the single producer of the ring. Samples are dropped if the ring is full.
+       *
+       * @param ring The ring buffer, held internally by pointer, or nullptr to not record latency.
+       */
+      void set_latency_ring(ring_t *ring) { _ring = ring; }
+
+      /**
+       * Set the lookahead table to brake ahead of time with, as in the @ref causal_trajectory_generator
+       * generate overload taking a @ref velocity_lookahead.
+       *
+       * @param lookahead The lookahead table, built for the same chassis and curves, held internally by
+       *                  pointer, or nullptr to not use a lookahead table.
+       */
+      void set_lookahead(const velocity_lookahead *lookahead) { _lookahead = lookahead; }
+
+      /**
+       * @return The number of curves in the path.
+       */
+      size_t curve_count() const { return _curves.size(); }
+
+      /**
+       * @return The total length of the path, in metres.
+       */
+      double length() const { return _curve_end.empty() ? 0 : _curve_end.back(); }
+
+     private:
+      path::curve<2> *find_curve(double targ_len, double &curve_len_out) const {
+        // The first curve that ends at or beyond the target.
+        size_t idx = std::lower_bound(_curve_end.begin(), _curve_end.end(), targ_len) - _curve_end.begin();
+        if (idx == _curves.size()) {
+          curve_len_out = targ_len;
+          return nullptr;
+        }
+
+        curve_len_out = targ_len - (idx > 0 ? _curve_end[idx - 1] : 0);
+        return _curves[idx];
+      }
+
+      std::vector<path::curve<2> *> _curves;
+      std::vector<double>           _curve_end;
+      ring_t *                      _ring      = nullptr;
+      const velocity_lookahead *    _lookahead = nullptr;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
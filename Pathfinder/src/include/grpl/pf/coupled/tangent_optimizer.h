@@ -0,0 +1,347 @@
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/path/arc_parameterizer.h"
+#include "grpl/pf/path/hermite.h"
+#include "grpl/pf/util/thread_pool.h"
+#include "noncausal_trajectory_generator.h"
+#include "state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Waypoint tangent optimizer, searching the tangents of a path's waypoints to minimize the time taken
+     * to follow it.
+     *
+     * The tangent magnitudes of a hermite path strongly affect its curvature, and therefore how fast the
+     * chassis may follow it. The optimizer performs a pattern search over the tangent of each waypoint:
+     * on each iteration, every waypoint's tangent is scaled up and down in magnitude, and every interior
+     * waypoint's tangent is rotated either way in direction. The tangent of the first and last waypoints
+     * is only ever scaled, so the start and end heading of the path are kept. The single move that reduces
+     * the trajectory time the most is applied. If no move reduces the time, the step sizes are halved,
+     * until they fall below the tolerance.
+     *
+     * The time of each candidate is estimated with a coarse @ref noncausal_trajectory_generator, which is
+     * much cheaper than running the causal generator to completion. Moving a single waypoint only changes
+     * the two hermite segments either side of it, so only those segments are parameterized per candidate;
+     * all other segments are reused from the current best path. Candidates are evaluated concurrently on
+     * a @ref grpl::pf::util::thread_pool.
+     *
+     * To optimize subject to a current limit, set the limit with @ref set_max_current(double). Candidates
+     * are then ranked first by how far their peak current exceeds the limit, and only then by time, such
+     * that the optimizer first reduces the peak current of a path until it is within the limit. The
+     * generator limits acceleration by the transmission model, but not the current drawn by sudden changes
+     * in curvature, so the limit is checked against the current of each state given by
+     * @ref chassis::split(const state) const. A chassis with current limited transmissions (see
+     * @ref grpl::pf::transmission::current_limited) is recommended, such that the acceleration of the
+     * chassis is also limited to that which can be achieved within the current limit.
+     *
+     * All storage is allocated on construction. Optimizing does not allocate, provided the path fits within
+     * the maximum sizes given on construction.
+     *
+     * @param hermite_t The type of hermite spline to fit the waypoints with.
+     * @param chassis_t The type of chassis (or @ref chassis_envelope) to generate with.
+     */
+    template <typename hermite_t = path::hermite_quintic, typename chassis_t = chassis>
+    class tangent_optimizer {
+     public:
+      using waypoint_t = typename hermite_t::waypoint;
+      using curve_t    = path::arc_parameterizer::curve_t;
+      using vector_t   = Eigen::Vector2d;
+
+      /**
+       * The outcome of a single optimization.
+       */
+      struct result {
+        //! Whether a buffer (segments, curves or states) was too small for the initial path. If set, the
+        //! waypoints are left unchanged.
+        bool overrun = false;
+        //! The number of iterations run.
+        size_t iterations = 0;
+        //! The number of candidate paths evaluated.
+        size_t evaluations = 0;
+        //! The estimated trajectory time of the path before optimization, in seconds.
+        double initial_time = 0;
+        //! The estimated trajectory time of the optimized path, in seconds.
+        double time = 0;
+        //! The peak current drawn by either transmission along the optimized path, in Amperes.
+        double peak_current = 0;
+        //! Whether the peak current of the optimized path is within the limit set by
+        //! @ref set_max_current(double).
+        bool within_current_limit = false;
+      };
+
+      /**
+       * Construct a tangent optimizer.
+       *
+       * @param pool          The thread pool to evaluate candidates on, held internally as a reference.
+       * @param chassis       The chassis to generate with, held internally as a reference. The chassis must
+       *                      be safe to share between threads.
+       * @param param         The configured arc parameterizer, copied and shared between all workers.
+       * @param max_waypoints The maximum number of waypoints in the path.
+       * @param max_curves    The maximum number of curves a single hermite segment may be parameterized
+       *                      into. Candidates that overrun this are discarded.
+       * @param max_states    The maximum number of states in the estimated trajectory. Candidates that
+       *                      overrun this are discarded.
+       */
+      tangent_optimizer(util::thread_pool &pool, const chassis_t &chassis,
+                        const path::arc_parameterizer &param, size_t max_waypoints, size_t max_curves,
+                        size_t max_states)
+          : _pool(pool),
+            _chassis(chassis),
+            _param(param),
+            _max_waypoints(max_waypoints),
+            _segments(max_waypoints > 1 ? max_waypoints - 1 : 0, segment(max_curves)),
+            _candidates(4 * max_waypoints) {
+        _workers.reserve(pool.size());
+        for (size_t i = 0; i < pool.size(); i++) _workers.emplace_back(max_waypoints, max_curves, max_states);
+      }
+
+      /**
+       * Configure the search.
+       *
+       * @param sample_distance The sample distance of the trajectory time estimator, in metres. See
+       *                        @ref noncausal_trajectory_generator::configure(double)
+       * @param max_iterations  The maximum number of iterations (applied moves or step reductions).
+       * @param magnitude_step  The initial step of the tangent magnitude, as a fraction of the magnitude.
+       *                        A step s scales the magnitude by (1 + s) and 1 / (1 + s).
+       * @param angle_step      The initial step of the tangent direction, in radians.
+       * @param tolerance       The search finishes once both steps fall below the tolerance.
+       */
+      void configure(double sample_distance, size_t max_iterations = 100, double magnitude_step = 0.5,
+                     double angle_step = 0.5, double tolerance = 0.01) {
+        _gen.configure(sample_distance);
+        _max_iterations = max_iterations;
+        _magnitude_step = magnitude_step;
+        _angle_step     = angle_step;
+        _tolerance      = tolerance;
+      }
+
+      /**
+       * Set the current limit of the search.
+       *
+       * @param max_current The maximum current drawn by either transmission at any point along the path,
+       *                    in Amperes. Infinite (no limit) by default.
+       */
+      void set_max_current(double max_current) { _max_current = max_current; }
+
+      /**
+       * Optimize the tangents of a path in place.
+       *
+       * @param waypoints Pointer to the first waypoint of the path. The tangents (and tangent derivatives,
+       *                  if rotated) of the waypoints are replaced with the optimized tangents.
+       * @param count     The number of waypoints in the path.
+       * @return          The outcome of the optimization.
+       */
+      result optimize(waypoint_t *waypoints, size_t count) {
+        result res;
+        if (count < 2 || count > _max_waypoints) {
+          res.overrun = count > _max_waypoints;
+          return res;
+        }
+
+        _waypoints = waypoints;
+        _count     = count;
+
+        for (size_t i = 0; i < count - 1; i++) {
+          if (!parameterize(_segments[i], waypoints[i], waypoints[i + 1])) {
+            res.overrun = true;
+            return res;
+          }
+        }
+
+        score best = evaluate(_workers[0], count, waypoints[0]);
+        if (!std::isfinite(best.time)) {
+          res.overrun = true;
+          return res;
+        }
+        res.initial_time = best.time;
+        res.evaluations  = 1;
+
+        double mag_step = _magnitude_step, angle_step = _angle_step;
+
+        while (res.iterations < _max_iterations && (mag_step >= _tolerance || angle_step >= _tolerance)) {
+          res.iterations++;
+
+          size_t n = 0;
+          for (size_t i = 0; i < count; i++) {
+            if (mag_step >= _tolerance) {
+              _candidates[n++] = candidate{i, 0, 1 + mag_step};
+              _candidates[n++] = candidate{i, 0, 1 / (1 + mag_step)};
+            }
+            if (angle_step >= _tolerance && i > 0 && i < count - 1) {
+              _candidates[n++] = candidate{i, angle_step, 1};
+              _candidates[n++] = candidate{i, -angle_step, 1};
+            }
+          }
+
+          auto job = [this](size_t idx, size_t worker) {
+            candidate &c = _candidates[idx];
+            c.result     = evaluate(_workers[worker], c.waypoint, apply(_waypoints[c.waypoint], c));
+          };
+          _pool.parallel_for(n, job);
+          res.evaluations += n;
+
+          const candidate *best_candidate = nullptr;
+          for (size_t i = 0; i < n; i++) {
+            const score &sc = _candidates[i].result;
+            if (sc < best && (best_candidate == nullptr || sc < best_candidate->result))
+              best_candidate = &_candidates[i];
+          }
+
+          if (best_candidate == nullptr) {
+            mag_step /= 2;
+            angle_step /= 2;
+            continue;
+          }
+
+          size_t i     = best_candidate->waypoint;
+          waypoints[i] = apply(waypoints[i], *best_candidate);
+          best         = best_candidate->result;
+
+          // Only the segments either side of the moved waypoint have changed.
+          if (i > 0) parameterize(_segments[i - 1], waypoints[i - 1], waypoints[i]);
+          if (i < count - 1) parameterize(_segments[i], waypoints[i], waypoints[i + 1]);
+        }
+
+        best                     = evaluate(_workers[0], count, waypoints[0]);
+        res.time                 = best.time;
+        res.peak_current         = peak_current(_workers[0]);
+        res.within_current_limit = res.peak_current <= _max_current;
+        return res;
+      }
+
+     private:
+      struct segment {
+        segment(size_t max_curves) : curves(max_curves) {}
+
+        std::vector<curve_t> curves;
+        size_t               count = 0;
+      };
+
+      struct worker {
+        worker(size_t max_waypoints, size_t max_curves, size_t max_states)
+            : before(max_curves), after(max_curves), states(max_states) {
+          path.reserve(max_waypoints * max_curves);
+        }
+
+        // The segments before and after the moved waypoint.
+        segment before, after;
+        // The curves of the candidate path, referencing the shared segments and the worker's own.
+        std::vector<std::reference_wrapper<path::curve<2>>> path;
+        std::vector<state>                                  states;
+        size_t                                              state_count = 0;
+      };
+
+      // Candidates are ranked by how far they exceed the current limit, and then by time.
+      struct score {
+        double excess_current = 0;
+        double time           = std::numeric_limits<double>::infinity();
+
+        bool operator<(const score &other) const {
+          if (excess_current != other.excess_current) return excess_current < other.excess_current;
+          return time < other.time;
+        }
+      };
+
+      struct candidate {
+        size_t waypoint;
+        double rotation, scale;
+        score  result;
+      };
+
+      static waypoint_t apply(const waypoint_t &wp, const candidate &c) {
+        waypoint_t out = wp;
+        out.tangent *= c.scale;
+        if (c.rotation != 0) {
+          Eigen::Rotation2Dd rot(c.rotation);
+          out.tangent = rot * out.tangent;
+          rotate_dtangent(out, rot);
+        }
+        return out;
+      }
+
+      // Cubic hermites have no tangent derivative.
+      template <typename wp_t>
+      static auto rotate_dtangent(wp_t &wp, const Eigen::Rotation2Dd &rot) -> decltype(wp.dtangent, void()) {
+        wp.dtangent = rot * wp.dtangent;
+      }
+
+      static void rotate_dtangent(...) {}
+
+      bool parameterize(segment &seg, const waypoint_t &start, const waypoint_t &end) const {
+        hermite_t                        hermite(start, end);
+        path::arc_parameterizer::context ctx;
+
+        curve_t *out = seg.curves.data();
+        seg.count    = _param.parameterize(hermite, out, seg.curves.size(), ctx);
+        return !ctx.overrun;
+      }
+
+      // Estimate the trajectory time of the current path with waypoint i replaced by wp. If i is the
+      // waypoint count, the current path is estimated unchanged.
+      score evaluate(worker &w, size_t i, const waypoint_t &wp) {
+        score sc;
+        sc.excess_current = std::numeric_limits<double>::infinity();
+
+        if (i < _count) {
+          if (i > 0 && !parameterize(w.before, _waypoints[i - 1], wp)) return sc;
+          if (i < _count - 1 && !parameterize(w.after, wp, _waypoints[i + 1])) return sc;
+        }
+
+        w.path.clear();
+        for (size_t s = 0; s < _count - 1; s++) {
+          segment *seg = &_segments[s];
+          if (i < _count && s + 1 == i) seg = &w.before;
+          if (i < _count && s == i) seg = &w.after;
+
+          for (size_t c = 0; c < seg->count; c++) w.path.push_back(seg->curves[c]);
+        }
+
+        w.state_count =
+            _gen.generate(_chassis, w.path.begin(), w.path.end(), w.states.begin(), w.states.size());
+        if (w.state_count == 0) return sc;
+
+        sc.time           = w.states[w.state_count - 1].time;
+        sc.excess_current = std::isinf(_max_current) ? 0 : std::max(0.0, peak_current(w) - _max_current);
+        return sc;
+      }
+
+      double peak_current(const worker &w) const {
+        double peak = 0;
+        for (size_t i = 0; i < w.state_count; i++) {
+          std::pair<wheel_state, wheel_state> split = _chassis.split(w.states[i]);
+          peak = std::max(peak, std::max(std::abs(split.first.current), std::abs(split.second.current)));
+        }
+        return peak;
+      }
+
+      util::thread_pool &            _pool;
+      const chassis_t &              _chassis;
+      const path::arc_parameterizer  _param;
+      noncausal_trajectory_generator _gen;
+      size_t                         _max_waypoints;
+
+      size_t _max_iterations = 100;
+      double _magnitude_step = 0.5, _angle_step = 0.5, _tolerance = 0.01;
+      double _max_current    = std::numeric_limits<double>::infinity();
+
+      // The segments of the current best path.
+      std::vector<segment>   _segments;
+      std::vector<candidate> _candidates;
+      std::vector<worker>    _workers;
+
+      waypoint_t *_waypoints = nullptr;
+      size_t      _count     = 0;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
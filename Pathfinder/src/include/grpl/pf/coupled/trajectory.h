@@ -0,0 +1,196 @@
+#pragma once
+
+#include "chassis.h"
+#include "state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * A time-parameterized trajectory of a coupled drivetrain, stored as a sequence of @ref state.
+     *
+     * The trajectory can be sampled at any point in time with @ref sample(double) const, or split into
+     * the left and right wheels with @ref sample_wheels(const chassis &, double) const. Sampling is
+     * constant-time: on construction the trajectory builds a uniform grid over time, where each bucket
+     * stores the index of the last state at or before the start of the bucket. A lookup is a single
+     * division, followed by a short forward search over the (few) states within the bucket.
+     *
+     * Between two states, the trajectory is interpolated consistently with the kinematics, assuming
+     * constant acceleration over the interval. As with the profiles, the acceleration used over an
+     * interval is the acceleration of the state at the end of the interval. The configuration, curvature
+     * and change in curvature are interpolated by the fraction of distance covered over the interval.
+     *
+     * The storage for the trajectory is allocated on construction. Sampling does not allocate, and the
+     * trajectory is immutable once constructed, so it may be sampled from multiple threads at once.
+     */
+    class trajectory {
+     public:
+      using container_t = std::vector<state>;
+      using iterator_t  = container_t::const_iterator;
+
+      /**
+       * Create a trajectory from a sequence of states, such as those generated by
+       * @ref noncausal_trajectory_generator or @ref causal_trajectory_generator.
+       *
+       * @param state_begin   Iterator to the first state in the trajectory. States must be in order
+       *                      of increasing time.
+       * @param state_end     Iterator to the end of the states in the trajectory.
+       * @param bucket_count  The number of buckets in the time index. If 0, one bucket is used per state,
+       *                      such that each bucket holds an average of one state.
+       */
+      template <typename iterator_state_t>
+      trajectory(const iterator_state_t state_begin, const iterator_state_t state_end, size_t bucket_count = 0)
+          : _states(state_begin, state_end) {
+        build_index(bucket_count == 0 ? _states.size() : bucket_count);
+      }
+
+      /**
+       * @return The number of states in the trajectory.
+       */
+      size_t size() const { return _states.size(); }
+
+      /**
+       * @return Whether the trajectory contains no states.
+       */
+      bool empty() const { return _states.empty(); }
+
+      /**
+       * @return The time of the first state in the trajectory, in seconds.
+       */
+      double start_time() const { return empty() ? 0 : _states.front().time; }
+
+      /**
+       * @return The time of the last state in the trajectory, in seconds.
+       */
+      double end_time() const { return empty() ? 0 : _states.back().time; }
+
+      /**
+       * @return The total duration of the trajectory, in seconds.
+       */
+      double duration() const { return end_time() - start_time(); }
+
+      /**
+       * Get a state of the trajectory by index, without interpolation.
+       *
+       * @param idx The index of the state.
+       * @return    The state at the given index.
+       */
+      const state &operator[](size_t idx) const { return _states[idx]; }
+
+      //! @return Iterator to the first state of the trajectory.
+      iterator_t begin() const { return _states.begin(); }
+      //! @return Iterator to the end of the trajectory.
+      iterator_t end() const { return _states.end(); }
+
+      /**
+       * Find the index of the state at or immediately before a given time.
+       *
+       * @param time  The time, in seconds.
+       * @return      The index of the last state with a time less than or equal to the given time. If the
+       *              time is before the start of the trajectory, 0 is returned.
+       */
+      size_t index_at(double time) const {
+        if (time <= start_time()) return 0;
+        if (time >= end_time()) return _states.size() - 1;
+
+        size_t bucket = static_cast<size_t>((time - start_time()) * _bucket_rate);
+        if (bucket >= _buckets.size()) bucket = _buckets.size() - 1;
+
+        size_t idx = _buckets[bucket];
+        while (idx + 1 < _states.size() && _states[idx + 1].time <= time) idx++;
+        return idx;
+      }
+
+      /**
+       * Sample the trajectory at a given time, interpolating between the states either side.
+       *
+       * @param time  The time to sample at, in seconds. Times before the start or after the end of the
+       *              trajectory are clamped to the first and last states respectively.
+       * @return      The interpolated state at the given time.
+       */
+      state sample(double time) const {
+        if (empty()) return state{};
+
+        size_t idx = index_at(time);
+        if (idx + 1 >= _states.size() || time <= _states[idx].time) {
+          state st = _states[idx];
+          if (time > st.time) st.time = time;
+          return st;
+        }
+
+        const state &s0 = _states[idx], &s1 = _states[idx + 1];
+
+        double tau   = time - s0.time;
+        double v0    = s0.kinematics[VELOCITY];
+        double accel = s1.kinematics[ACCELERATION];
+        double x0    = s0.kinematics[POSITION];
+        double x1    = s1.kinematics[POSITION];
+
+        // x = x0 + ut + 1/2at^2, clamped to the interval in case of floating point error.
+        double x = x0 + v0 * tau + 0.5 * accel * tau * tau;
+        x        = std::max(std::min(x, std::max(x0, x1)), std::min(x0, x1));
+
+        double dx   = x1 - x0;
+        double frac = std::abs(dx) > constants::epsilon ? (x - x0) / dx : tau / (s1.time - s0.time);
+
+        double heading0 = s0.config[2];
+        double dheading = std::remainder(s1.config[2] - heading0, 2 * constants::PI);
+
+        state st;
+        st.time                     = time;
+        st.curvature                = s0.curvature + frac * (s1.curvature - s0.curvature);
+        st.dcurvature               = s0.dcurvature + frac * (s1.dcurvature - s0.dcurvature);
+        st.config                   = s0.config + frac * (s1.config - s0.config);
+        st.config[2]                = heading0 + frac * dheading;
+        st.kinematics[POSITION]     = x;
+        st.kinematics[VELOCITY]     = v0 + accel * tau;
+        st.kinematics[ACCELERATION] = accel;
+        st.finished                 = false;
+        return st;
+      }
+
+      /**
+       * Sample the trajectory at a given time, and split it into the left and right wheels of the chassis.
+       * See @ref sample(double) const and @ref chassis::split(const state) const.
+       *
+       * @param chassis The coupled chassis, used to split the trajectory.
+       * @param time    The time to sample at, in seconds.
+       * @return        A pair of wheel states, ordered left, right.
+       */
+      std::pair<wheel_state, wheel_state> sample_wheels(const chassis &chassis, double time) const {
+        return chassis.split(sample(time));
+      }
+
+     private:
+      void build_index(size_t bucket_count) {
+        double span = duration();
+        if (empty() || span <= 0) {
+          _bucket_rate = 0;
+          _buckets.assign(1, 0);
+          return;
+        }
+
+        _bucket_rate = bucket_count / span;
+        _buckets.resize(bucket_count);
+
+        // Each bucket starts at the last state at or before the start time of the bucket.
+        size_t idx = 0;
+        for (size_t b = 0; b < bucket_count; b++) {
+          double bucket_start = start_time() + b / _bucket_rate;
+          while (idx + 1 < _states.size() && _states[idx + 1].time <= bucket_start) idx++;
+          _buckets[b] = idx;
+        }
+      }
+
+      container_t         _states;
+      std::vector<size_t> _buckets;
+      double              _bucket_rate = 0;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
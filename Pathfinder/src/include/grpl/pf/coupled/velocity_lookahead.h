@@ -0,0 +1,161 @@
+#pragma once
+
+#include "chassis.h"
+#include "grpl/pf/path/curve.h"
+#include "state.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    /**
+     * Precomputed maximum safe velocity along a path, used by @ref causal_trajectory_generator to brake in
+     * time for the end of the path and for tight curves ahead.
+     *
+     * The causal generator only knows the current state, and so only brakes for the end of the path (by
+     * its profile) and not for limits ahead of it. The lookahead table holds, at a fixed distance interval
+     * along the path, the maximum velocity from which the chassis can still decelerate to meet every
+     * velocity limit ahead, ending at rest at the end of the path. This is the reverse pass of
+     * @ref noncausal_trajectory_generator: the path is sampled, each sample limited by
+     * @ref chassis::linear_vel_limit(const configuration_state &, double) const, and a backward pass then
+     * limits each sample by the deceleration of the chassis.
+     *
+     * The table is built once per path (see @ref build()). Querying the table (see
+     * @ref max_velocity(double) const) is O(1), and does not allocate.
+     */
+    class velocity_lookahead {
+     public:
+      /**
+       * Create an empty lookahead table. The table does not limit the velocity until built.
+       *
+       * @param sample_distance The distance between two consecutive samples along the path, in metres.
+       */
+      explicit velocity_lookahead(double sample_distance = 0.01) : _sample_distance(sample_distance) {}
+
+      /**
+       * Build the table for a path, replacing the current table.
+       *
+       * @param chassis     The coupled chassis, used to provide limits for the trajectory. Any type
+       *                    providing the limits of a chassis may be used, such as @ref chassis_envelope or
+       *                    @ref constrained_chassis.
+       * @param curve_begin Iterator pointing to the start of the curve collection.
+       * @param curve_end   Iterator pointing to the end of the curve collection.
+       */
+      template <typename iterator_curve_t, typename chassis_t = chassis>
+      void build(const chassis_t &chassis, const iterator_curve_t curve_begin,
+                 const iterator_curve_t curve_end) {
+        _length = 0;
+        for (iterator_curve_t it = curve_begin; it != curve_end; it++) _length += curve_length(it);
+
+        if (curve_begin == curve_end) {
+          _vel2.clear();
+          return;
+        }
+
+        size_t intervals = static_cast<size_t>(ceil(_length / _sample_distance - constants::epsilon));
+        size_t count     = (intervals < 1 ? 1 : intervals) + 1;
+        _vel2.resize(count);
+        _config.resize(count);
+        _curvature.resize(count);
+
+        // Sample the path, and apply the velocity limit to each sample.
+        iterator_curve_t curve       = curve_begin;
+        double           curve_start = 0;
+
+        for (size_t i = 0; i < count; i++) {
+          double distance = position(i);
+
+          iterator_curve_t next = curve;
+          while (++next != curve_end && curve_start + curve_length(curve) < distance) {
+            curve_start += curve_length(curve);
+            curve = next;
+          }
+
+          double          curve_distance = distance - curve_start;
+          path::curve<2> &c              = *curve;
+
+          auto centre     = c.position(curve_distance);
+          auto centre_rot = c.rotation(curve_distance);
+
+          _config[i]    = configuration_state{centre.x(), centre.y(), atan2(centre_rot.y(), centre_rot.x())};
+          _curvature[i] = c.curvature(curve_distance);
+
+          double limit = chassis.linear_vel_limit(_config[i], _curvature[i]);
+          _vel2[i]     = limit * limit;
+        }
+
+        // Reverse pass, limited by maximum deceleration. We end at rest.
+        _vel2[count - 1] = 0;
+        for (size_t i = count - 1; i > 0; i--) {
+          double ds    = position(i) - position(i - 1);
+          double v     = sqrt(_vel2[i]);
+          double decel = chassis.acceleration_limits(_config[i], _curvature[i], v).first;
+
+          // u^2 = v^2 - 2as
+          _vel2[i - 1] = std::min(_vel2[i - 1], std::max(0.0, _vel2[i] - 2 * std::min(0.0, decel) * ds));
+        }
+      }
+
+      /**
+       * Get the maximum safe velocity at a distance along the path.
+       *
+       * The velocity is interpolated between samples assuming constant deceleration (linearly in v^2).
+       *
+       * @param distance  The distance along the path, in metres.
+       * @return          The maximum safe velocity, in metres per second (ms^-1). 0 at and beyond the end of
+       *                  the path, or infinite if the table is not built.
+       */
+      double max_velocity(double distance) const {
+        size_t count = _vel2.size();
+        if (count == 0) return std::numeric_limits<double>::infinity();
+        if (distance <= 0) return sqrt(_vel2[0]);
+        if (distance >= _length) return 0;
+
+        size_t idx = std::min(static_cast<size_t>(distance / _sample_distance), count - 2);
+        double lo = position(idx), hi = position(idx + 1);
+        double f  = hi > lo ? (distance - lo) / (hi - lo) : 1;
+
+        return sqrt(std::max(0.0, _vel2[idx] + f * (_vel2[idx + 1] - _vel2[idx])));
+      }
+
+      /**
+       * @return The distance between two consecutive samples along the path, in metres.
+       */
+      double sample_distance() const { return _sample_distance; }
+
+      /**
+       * @return The length of the path, in metres, as of the last @ref build().
+       */
+      double length() const { return _length; }
+
+      /**
+       * @return The number of samples in the table.
+       */
+      size_t size() const { return _vel2.size(); }
+
+     private:
+      // The last sample lies at the end of the path, which may not be on the sample grid.
+      double position(size_t idx) const {
+        return idx == _vel2.size() - 1 ? _length : std::min(_length, idx * _sample_distance);
+      }
+
+      template <typename iterator_curve_t>
+      static inline double curve_length(const iterator_curve_t it) {
+        path::curve<2> &curve = *it;
+        return curve.length();
+      }
+
+      double _sample_distance, _length = 0;
+      // Squared maximum velocity of each sample, and the configuration and curvature used to find it.
+      std::vector<double>              _vel2;
+      std::vector<configuration_state> _config;
+      std::vector<double>              _curvature;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "grpl/pf/constants.h"
+#include "state.h"
+
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace coupled {
+
+    template <typename, typename>
+    class basic_chassis;
+
+    /**
+     * The track of a single wheel (side) of a coupled drivetrain over a whole trajectory, stored in
+     * structure-of-arrays form.
+     *
+     * A wheel track is the batch equivalent of a sequence of @ref wheel_state, as produced by splitting a
+     * whole trajectory at once with the batch @ref basic_chassis::split.
+     * Each quantity is held in its own contiguous column, suitable for bulk export to motor controllers.
+     *
+     * The storage for the track is allocated on construction. Splitting into a track does not allocate.
+     */
+    class wheel_track {
+     public:
+      using array_t     = Eigen::Array<double, Eigen::Dynamic, 1>;
+      using const_map_t = Eigen::Map<const array_t>;
+      using column_t    = std::vector<double>;
+
+      /**
+       * Create an empty wheel track.
+       *
+       * @param capacity The maximum number of states held by the track.
+       */
+      wheel_track(size_t capacity)
+          : _capacity(capacity),
+            _time(capacity, 0),
+            _x(capacity, 0),
+            _y(capacity, 0),
+            _velocity(capacity, 0),
+            _acceleration(capacity, 0),
+            _voltage(capacity, 0),
+            _current(capacity, 0) {}
+
+      /**
+       * @return The maximum number of states held by the track.
+       */
+      size_t capacity() const { return _capacity; }
+
+      /**
+       * @return The number of states currently held by the track.
+       */
+      size_t size() const { return _size; }
+
+      /**
+       * @return Whether the last state of the track is the end of the trajectory.
+       */
+      bool finished() const { return _finished; }
+
+      /**
+       * Get a single state of the track.
+       *
+       * @param idx The index of the state in the track.
+       * @return    The state of the wheel, equivalent to that provided by
+       *            @ref basic_chassis::split(const state) const
+       */
+      wheel_state get_state(size_t idx) const {
+        wheel_state st;
+        st.time                     = _time[idx];
+        st.position                 = wheel_state::vector_t{_x[idx], _y[idx]};
+        st.kinematics[VELOCITY]     = _velocity[idx];
+        st.kinematics[ACCELERATION] = _acceleration[idx];
+        st.voltage                  = _voltage[idx];
+        st.current                  = _current[idx];
+        st.finished                 = _finished && idx == _size - 1;
+        return st;
+      }
+
+      //! @return The time point of each state, in seconds.
+      const_map_t time() const { return const_map_t(_time.data(), _size); }
+      //! @return The x position of the wheel at each state, in metres.
+      const_map_t x() const { return const_map_t(_x.data(), _size); }
+      //! @return The y position of the wheel at each state, in metres.
+      const_map_t y() const { return const_map_t(_y.data(), _size); }
+      //! @return The linear velocity of the wheel at each state, in metres per second (ms^-1).
+      const_map_t velocity() const { return const_map_t(_velocity.data(), _size); }
+      //! @return The linear acceleration of the wheel at each state, in metres per second per second (ms^-2).
+      const_map_t acceleration() const { return const_map_t(_acceleration.data(), _size); }
+      //! @return The voltage applied to the transmission at each state, in Volts.
+      const_map_t voltage() const { return const_map_t(_voltage.data(), _size); }
+      //! @return The current drawn by the transmission at each state, in Amperes.
+      const_map_t current() const { return const_map_t(_current.data(), _size); }
+
+     private:
+      template <typename, typename>
+      friend class basic_chassis;
+
+      size_t   _capacity, _size = 0;
+      bool     _finished        = false;
+      column_t _time, _x, _y, _velocity, _acceleration, _voltage, _current;
+    };
+  }  // namespace coupled
+}  // namespace pf
+}  // namespace grpl
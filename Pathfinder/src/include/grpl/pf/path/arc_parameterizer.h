@@ -20,12 +20,23 @@ namespace pf {
      * arcs parameterized by arc length 's'. The parameterizer uses augmented arcs, which are of a
      * non-constant curvature in order to approximate the spline while still remaining continuous in
      * curvature at the knot points.
+     *
+     * A configured parameterizer may be shared between threads by using the overloads of parameterize
+     * that take a caller-owned @ref context, which do not modify the parameterizer.
      */
     class arc_parameterizer {
      public:
       using curve_t  = augmented_arc2d;
       using vector_t = curve_t::vector_t;
 
+      /**
+       * The per-run state of a parameterization, owned by the caller.
+       */
+      struct context {
+        //! Whether the curve output container was too small for the parameterization.
+        bool overrun = false;
+      };
+
       arc_parameterizer() {}
 
       /**
@@ -94,6 +105,10 @@ namespace pf {
        * Reparameterizes a spline from being with respect to spline parameter 't', to a set of curves that are
        * with respect to arc length 's'.
        *
+       * Overrun is recorded on the parameterizer, see @ref has_overrun(). Use
+       * @ref parameterize(spline<2> &, output_iterator_t &&, const size_t, context &, double, double) const
+       * to share a single parameterizer between threads.
+       *
        * @param spline          The spline to parameterize
        * @param curve_begin     Iterator to the beginning of the curve output container. Must be an output
        *                        iterator.
@@ -104,9 +119,32 @@ namespace pf {
       template <typename output_iterator_t>
       size_t parameterize(spline<2> &spline, output_iterator_t &&curve_begin, const size_t max_curve_count,
                           double t_lo = 0, double t_hi = 1) {
-        _has_overrun = false;
+        context ctx;
+        size_t  len  = parameterize(spline, curve_begin, max_curve_count, ctx, t_lo, t_hi);
+        _has_overrun = ctx.overrun;
+        return len;
+      }
+
+      /**
+       * Parameterize a single spline into augmented 2D arcs, recording overrun in a caller-owned context.
+       *
+       * This method does not modify the parameterizer, and may be called concurrently from many threads.
+       * See @ref parameterize(spline<2> &, output_iterator_t &&, const size_t, double, double)
+       *
+       * @param spline          The spline to parameterize
+       * @param curve_begin     Iterator to the beginning of the curve output container. Must be an output
+       *                        iterator.
+       * @param max_curve_count The maximum size of the curve output container.
+       * @param ctx             The context of this run. The overrun flag is set if the output container is
+       *                        too small, and is never cleared.
+       * @param t_lo            The start value of the spline parameter, set on recursive calls.
+       * @param t_hi            The end value of the spline parameter, set on recursive calls.
+       */
+      template <typename output_iterator_t>
+      size_t parameterize(spline<2> &spline, output_iterator_t &&curve_begin, const size_t max_curve_count,
+                          context &ctx, double t_lo = 0, double t_hi = 1) const {
         if (max_curve_count <= 0) {
-          _has_overrun = true;
+          ctx.overrun = true;
           return 0;
         }
 
@@ -121,8 +159,8 @@ namespace pf {
         if (subdivide) {
           output_iterator_t head = curve_begin;
 
-          size_t len = parameterize(spline, head, max_curve_count, t_lo, t_mid);
-          len += parameterize(spline, head, max_curve_count - len, t_mid, t_hi);
+          size_t len = parameterize(spline, head, max_curve_count, ctx, t_lo, t_mid);
+          len += parameterize(spline, head, max_curve_count - len, ctx, t_mid, t_hi);
           return len;
         } else {
           arc.set_curvature(k_lo, k_hi);
@@ -146,9 +184,32 @@ namespace pf {
       template <typename output_iterator_t, typename iterator_spline_t>
       size_t parameterize(const iterator_spline_t spline_begin, const iterator_spline_t spline_end,
                           output_iterator_t &&curve_begin, const size_t max_curve_count) {
+        context ctx;
+        size_t  len  = parameterize(spline_begin, spline_end, curve_begin, max_curve_count, ctx);
+        _has_overrun = ctx.overrun;
+        return len;
+      }
+
+      /**
+       * Parameterize a container of splines into augmented 2D arcs, recording overrun in a caller-owned
+       * context.
+       *
+       * This method does not modify the parameterizer, and may be called concurrently from many threads.
+       *
+       * @param spline_begin    Iterator to the start of the splines container.
+       * @param spline_end      Iterator to the end of the splines container.
+       * @param curve_begin     Iterator to the beginning of the curve output container. Must be an output
+       *                        iterator.
+       * @param max_curve_count The maximum size of the curve output container.
+       * @param ctx             The context of this run. The overrun flag is set if the output container is
+       *                        too small, and is never cleared.
+       */
+      template <typename output_iterator_t, typename iterator_spline_t>
+      size_t parameterize(const iterator_spline_t spline_begin, const iterator_spline_t spline_end,
+                          output_iterator_t &&curve_begin, const size_t max_curve_count, context &ctx) const {
         size_t len = 0;
         for (iterator_spline_t it = spline_begin; it != spline_end; it++) {
-          len += parameterize(*it, curve_begin, max_curve_count - len);
+          len += parameterize(*it, curve_begin, max_curve_count - len, ctx);
         }
         return len;
       }
@@ -159,12 +220,12 @@ namespace pf {
        *
        * @return true if the last call to parameterize has overrun the maximum length of the buffer provided.
        */
-      bool has_overrun() { return _has_overrun; }
+      bool has_overrun() const { return _has_overrun; }
 
      private:
       double _max_arc_length;
       double _max_delta_curvature;
-      bool   _has_overrun;
+      bool   _has_overrun = false;
     };
   }  // namespace path
 }  // namespace pf
@@ -101,7 +101,7 @@ namespace pf {
        * @param start The waypoint of the start of the spline
        * @param end   The waypoint of the end of the spline.
        */
-      hermite_cubic(waypoint &start, waypoint &end) { set_waypoints(start, end); }
+      hermite_cubic(const waypoint &start, const waypoint &end) { set_waypoints(start, end); }
 
       /**
        * Set the start and end waypoints of the spline.
@@ -109,7 +109,7 @@ namespace pf {
        * @param start The waypoint of the start of the spline
        * @param end   The waypoint of the end of the spline.
        */
-      void set_waypoints(waypoint &start, waypoint &end) {
+      void set_waypoints(const waypoint &start, const waypoint &end) {
         _M.col(0) = start.position;
         _M.col(1) = start.tangent;
         _M.col(2) = end.position;
@@ -166,7 +166,7 @@ namespace pf {
        * @param start The waypoint of the start of the spline
        * @param end   The waypoint of the end of the spline.
        */
-      hermite_quintic(waypoint &start, waypoint &end) { set_waypoints(start, end); }
+      hermite_quintic(const waypoint &start, const waypoint &end) { set_waypoints(start, end); }
 
       /**
        * Set the start and end waypoints of the spline.
@@ -174,7 +174,7 @@ namespace pf {
        * @param start The waypoint of the start of the spline
        * @param end   The waypoint of the end of the spline.
        */
-      void set_waypoints(waypoint &start, waypoint &end) {
+      void set_waypoints(const waypoint &start, const waypoint &end) {
         _M.col(0) = start.position;
         _M.col(1) = start.tangent;
         _M.col(2) = start.dtangent;
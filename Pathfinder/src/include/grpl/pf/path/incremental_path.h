@@ -0,0 +1,171 @@
+#pragma once
+
+#include "arc_parameterizer.h"
+#include "hermite.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace path {
+
+    /**
+     * A hermite path that is re-parameterized incrementally as its waypoints are edited.
+     *
+     * The path holds its waypoints, and the curves each hermite segment (between two consecutive
+     * waypoints) is parameterized into by an @ref arc_parameterizer. Moving a single waypoint only changes
+     * the two segments either side of it, so editing a waypoint only marks those segments as dirty. A call
+     * to @ref update() then re-parameterizes only the dirty segments, and recalculates the cumulative length
+     * at the start of each segment from the first dirty segment onward.
+     *
+     * @ref update() returns the distance along the path from which the path has changed, such that any
+     * plan over the path (e.g. @ref grpl::pf::coupled::incremental_velocity_plan) only needs to be
+     * recalculated from that distance onward.
+     *
+     * The curves of the whole path are available as a single sequence of references through
+     * @ref begin() const and @ref end() const, which can be given directly to the trajectory generators.
+     * The sequence is invalidated by @ref update().
+     *
+     * @param hermite_t The type of hermite spline to fit the waypoints with.
+     */
+    template <typename hermite_t = hermite_quintic>
+    class incremental_path {
+     public:
+      using waypoint_t     = typename hermite_t::waypoint;
+      using curve_t        = arc_parameterizer::curve_t;
+      using curve_ref_t    = std::reference_wrapper<curve<2>>;
+      using curve_iterator = typename std::vector<curve_ref_t>::const_iterator;
+
+      /**
+       * Create an empty incremental path.
+       *
+       * @param param The configured arc parameterizer, held internally as a copy.
+       */
+      incremental_path(const arc_parameterizer &param) : _param(param) {}
+
+      /**
+       * Replace all waypoints of the path, marking every segment as dirty.
+       *
+       * @param wp_begin  Iterator to the first waypoint.
+       * @param wp_end    Iterator to the end of the waypoints.
+       */
+      template <typename iterator_wp_t>
+      void set_waypoints(const iterator_wp_t wp_begin, const iterator_wp_t wp_end) {
+        _waypoints.assign(wp_begin, wp_end);
+
+        size_t segments = _waypoints.size() > 1 ? _waypoints.size() - 1 : 0;
+        _segments.resize(segments);
+        _segment_start.resize(segments + 1);
+        _dirty.assign(segments, true);
+      }
+
+      /**
+       * Move a single waypoint of the path, marking the segments either side of it as dirty.
+       *
+       * @param idx The index of the waypoint.
+       * @param wp  The new waypoint.
+       */
+      void set_waypoint(size_t idx, const waypoint_t &wp) {
+        _waypoints[idx] = wp;
+        if (idx > 0) _dirty[idx - 1] = true;
+        if (idx < _segments.size()) _dirty[idx] = true;
+      }
+
+      /**
+       * @param idx The index of the waypoint.
+       * @return    The waypoint at the given index.
+       */
+      const waypoint_t &waypoint(size_t idx) const { return _waypoints[idx]; }
+
+      /**
+       * @return The number of waypoints in the path.
+       */
+      size_t waypoint_count() const { return _waypoints.size(); }
+
+      /**
+       * @return The number of hermite segments in the path (one less than the number of waypoints).
+       */
+      size_t segment_count() const { return _segments.size(); }
+
+      /**
+       * Re-parameterize all dirty segments, and update the cumulative lengths and the curve sequence.
+       *
+       * @return The distance along the path, in metres, from which the path has changed since the last
+       *         update. If the path has not changed, this is the length of the path.
+       */
+      double update() {
+        size_t first = std::find(_dirty.begin(), _dirty.end(), true) - _dirty.begin();
+
+        for (size_t i = first; i < _segments.size(); i++) {
+          if (_dirty[i]) {
+            hermite_t hermite(_waypoints[i], _waypoints[i + 1]);
+
+            _segments[i].clear();
+            _param.parameterize(hermite, std::back_inserter(_segments[i]), _segments[i].max_size());
+            _dirty[i] = false;
+          }
+
+          double length = 0;
+          for (curve_t &c : _segments[i]) length += c.length();
+          _segment_start[i + 1] = _segment_start[i] + length;
+        }
+
+        // Segments may have moved in memory, so the whole sequence is rebuilt. This is only a list of
+        // references, and is cheap compared to parameterizing even a single segment.
+        _curves.clear();
+        for (std::vector<curve_t> &seg : _segments)
+          for (curve_t &c : seg) _curves.push_back(c);
+
+        return _segment_start[first];
+      }
+
+      /**
+       * @param segment The index of the segment.
+       * @return        Whether the segment has changed and not yet been re-parameterized by
+       *                @ref update().
+       */
+      bool dirty(size_t segment) const { return _dirty[segment]; }
+
+      /**
+       * @param segment The index of the segment, or @ref segment_count() for the end of the path.
+       * @return        The distance along the path at the start of the segment, in metres, as of the last
+       *                @ref update().
+       */
+      double segment_start(size_t segment) const { return _segment_start[segment]; }
+
+      /**
+       * @return The total length of the path, in metres, as of the last @ref update().
+       */
+      double length() const { return _segment_start.back(); }
+
+      /**
+       * @return The number of curves in the path, as of the last @ref update().
+       */
+      size_t curve_count() const { return _curves.size(); }
+
+      /**
+       * @return Iterator to the first curve of the path.
+       */
+      curve_iterator begin() const { return _curves.begin(); }
+
+      /**
+       * @return Iterator to the end of the curves of the path.
+       */
+      curve_iterator end() const { return _curves.end(); }
+
+     private:
+      arc_parameterizer _param;
+
+      std::vector<waypoint_t>           _waypoints;
+      std::vector<std::vector<curve_t>> _segments;
+      // The cumulative length at the start of each segment, followed by the total length.
+      std::vector<double>      _segment_start{0};
+      std::vector<bool>        _dirty;
+      std::vector<curve_ref_t> _curves;
+    };
+  }  // namespace path
+}  // namespace pf
+}  // namespace grpl
@@ -1,7 +1,19 @@
 // Coupled
+#include "coupled/batch_simulator.h"
+#include "coupled/batch_trajectory_generator.h"
 #include "coupled/causal_trajectory_generator.h"
 #include "coupled/chassis.h"
+#include "coupled/chassis_envelope.h"
+#include "coupled/constrained_chassis.h"
+#include "coupled/constraints.h"
+#include "coupled/incremental_velocity_plan.h"
+#include "coupled/noncausal_trajectory_generator.h"
+#include "coupled/realtime_trajectory_generator.h"
 #include "coupled/state.h"
+#include "coupled/tangent_optimizer.h"
+#include "coupled/trajectory.h"
+#include "coupled/velocity_lookahead.h"
+#include "coupled/wheel_track.h"
 
 // Path
 #include "path/arc.h"
@@ -9,11 +21,23 @@
 #include "path/augmented_arc.h"
 #include "path/curve.h"
 #include "path/hermite.h"
+#include "path/incremental_path.h"
 #include "path/spline.h"
 
 // Profile
 #include "profile/profile.h"
 #include "profile/trapezoidal.h"
+#include "profile/trapezoidal_batch.h"
+
+// Transmission
+#include "transmission/current_limit.h"
+#include "transmission/dc.h"
+
+// Util
+#include "util/cycle_clock.h"
+#include "util/spsc_ring.h"
+#include "util/task_executor.h"
+#include "util/thread_pool.h"
 
 #include "constants.h"
 
@@ -47,11 +47,40 @@ namespace pf {
      * Since the system is predictive, it may result in a small oscillation or sudden deceleration
      * if a sufficient timestep is not used. For this reason, a timeslice mechanism is included in the
      * profile.
+     *
+     * The goal and limits of a profile typically change on every call (e.g. when following a path), while
+     * the timeslice and the profile shape do not. The goal and limits may be kept by the caller in a
+     * @ref context and passed to @ref calculate(const context &, const state &, double) const, which does
+     * not modify the profile. In this way, a single profile may be shared between many threads without
+     * copies or locks, each with their own context.
      */
     class profile {
      public:
       using limits_t = Eigen::Matrix<double, 2, constants::profile_limits_order>;
 
+      /**
+       * The per-run goal and limits of a profile, owned by the caller.
+       */
+      struct context {
+        //! The goal (setpoint) of the profile, in metres.
+        double goal = 0;
+        //! The limits of the profile. Row 0 is the minimum values, row 1 is the maximum. The column indices
+        //! match those of the terms (see constants in @ref grpl::pf)
+        limits_t limits = limits_t::Zero();
+
+        /**
+         * Apply a constrained limit to the context. See @ref profile::apply_limit(int, double, double)
+         *
+         * @param term  The term to apply the limit to. See constants in @ref grpl::pf
+         * @param min   The minimum value of the term, in the units of the term
+         * @param max   The maximum value of the term, in the units of the term
+         */
+        void apply_limit(int term, double min, double max) {
+          limits(0, term) = min;
+          limits(1, term) = max;
+        }
+      };
+
       virtual ~profile() {}
 
       /**
@@ -97,6 +126,26 @@ namespace pf {
        */
       double get_timeslice() const { return _timeslice; }
 
+      /**
+       * Set the maximum number of timeslices a single call to @ref calculate(state&, double) may be split
+       * into.
+       *
+       * Without a maximum, the cost of a single call grows with the period between calls (e.g. after a
+       * missed cycle). Setting a maximum bounds the cost of each call, for use in a hard real-time loop.
+       * If the period would require more timeslices than the maximum, the period is instead split into
+       * the maximum number of equal, longer timeslices.
+       *
+       * @param max_slices The maximum number of timeslices per call, or 0 for no maximum.
+       */
+      void set_max_slices(int max_slices) { _max_slices = max_slices; }
+
+      /**
+       * Get the maximum number of timeslices per call.
+       *
+       * @return The maximum number of timeslices per call, or 0 if there is no maximum.
+       */
+      int get_max_slices() const { return _max_slices; }
+
       /**
        * Apply a constrained limit to the profile. This will limit the maximum and minimum value of
        * this term during the profile (e.g. maximum velocity / acceleration).
@@ -119,7 +168,38 @@ namespace pf {
        * @return The limits matrix. Row 0 is the minimum values, row 1 is the maximum. The column indices
        * match those of the terms (see constants in @ref grpl::pf)
        */
-      limits_t get_limits() { return _limits; }
+      limits_t get_limits() const { return _limits; }
+
+      /**
+       * Obtain the currently set goal and limits of the profile as a context.
+       *
+       * @return A context holding the goal and limits of the profile.
+       */
+      context get_context() const {
+        context ctx;
+        ctx.goal   = _goal;
+        ctx.limits = _limits;
+        return ctx;
+      }
+
+      /**
+       * Set the goal and limits of the profile from a context.
+       *
+       * @param ctx The context holding the goal and limits to set.
+       */
+      void set_context(const context &ctx) {
+        _goal   = ctx.goal;
+        _limits = ctx.limits;
+      }
+
+      /**
+       * Calculate a single state of the motion profile, in a predictive manner, using the goal and limits
+       * set on the profile.
+       *
+       * Equivalent to @ref calculate(const context &, const state &, double) const with the context given
+       * by @ref get_context() const.
+       */
+      state calculate(state &last, double time) { return calculate(get_context(), last, time); }
 
       /**
        * Calculate a single state of the motion profile, in a predictive manner.
@@ -129,11 +209,18 @@ namespace pf {
        * begin slowing down in order to not overshoot the setpoint. This means the profile calculation does
        * not require a full history of the profile, allowing it to adjust to changing system conditions and
        * limits.
+       *
+       * This method does not modify the profile, and may be called concurrently from many threads.
+       *
+       * @param ctx   The goal and limits to use for this calculation.
+       * @param last  The last (current) state of the system.
+       * @param time  The time of the next state, in seconds.
        */
-      virtual state calculate(state &last, double time) = 0;
+      virtual state calculate(const context &ctx, const state &last, double time) const = 0;
 
      protected:
-      double   _goal, _timeslice = 0.001;
+      double   _goal = 0, _timeslice = 0.001;
+      int      _max_slices = 0;
       limits_t _limits = limits_t::Zero();
     };
 
@@ -25,9 +25,11 @@ namespace pf {
      */
     class trapezoidal : public profile {
      public:
+      using profile::calculate;
+
       const size_t limited_term() const override { return ACCELERATION; }
 
-      state calculate(state &last, double time) override {
+      state calculate(const context &ctx, const state &last, double time) const override {
         double dt          = time - last.time;
         double timestep    = dt;
         int    slice_count = 1;
@@ -40,12 +42,17 @@ namespace pf {
           if (slice_count < 1) slice_count++;
 
           timestep = this->_timeslice;
+
+          if (this->_max_slices > 0 && slice_count > this->_max_slices) {
+            slice_count = this->_max_slices;
+            timestep    = dt / slice_count;
+          }
         }
 
-        double vel_min   = this->_limits(0, 1);
-        double vel_max   = this->_limits(1, 1);
-        double accel_min = this->_limits(0, 2);
-        double accel_max = this->_limits(1, 2);
+        double vel_min   = ctx.limits(0, 1);
+        double vel_max   = ctx.limits(1, 1);
+        double accel_min = ctx.limits(0, 2);
+        double accel_max = ctx.limits(1, 2);
 
         state cur = last;
 
@@ -58,7 +65,7 @@ namespace pf {
 
           auto &kin = cur.kinematics;
 
-          double error = kin[POSITION] - this->_goal;
+          double error = kin[POSITION] - ctx.goal;
           double accel = (error < 0 ? accel_max : accel_min);
 
           // TODO: Find point at which we reach v_max and if it's less than dt, split
@@ -68,7 +75,7 @@ namespace pf {
 
           double decel_time  = v_projected / -accel_min;
           double decel_dist  = v_projected * decel_time + 0.5 * accel_min * decel_time * decel_time;
-          double decel_error = kin[POSITION] + decel_dist - this->_goal;
+          double decel_error = kin[POSITION] + decel_dist - ctx.goal;
 
           // TODO: make this better
           // If we decelerate now, do we cross the zero of the error function?
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "dc.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace grpl {
+namespace pf {
+  namespace transmission {
+
+    /**
+     * A DC transmission with its current draw limited, such as by a motor controller's current limit or a
+     * breaker.
+     *
+     * The current limited transmission wraps another transmission, limiting the current given by
+     * @ref get_current(double, double) const to [-limit, limit]. All other calls are passed through to
+     * the wrapped transmission. When used in a chassis (see @ref grpl::pf::coupled::basic_chassis), this
+     * limits the acceleration of the chassis such that no transmission exceeds the current limit.
+     *
+     * @param transmission_t The type of the wrapped transmission, e.g. @ref dc_motor.
+     */
+    template <typename transmission_t = dc_transmission>
+    class current_limited final : public dc_transmission {
+     public:
+      /**
+       * Construct a current limited transmission.
+       *
+       * @param transmission  The transmission to limit, held internally as a reference.
+       * @param current_limit The maximum absolute current drawn by the transmission, in Amps.
+       */
+      current_limited(const transmission_t &transmission, double current_limit)
+          : _transmission(transmission), _limit(std::abs(current_limit)) {}
+
+      /**
+       * @return Reference to the wrapped transmission.
+       */
+      const transmission_t &transmission() const { return _transmission; }
+
+      /**
+       * @return The maximum absolute current drawn by the transmission, in Amps.
+       */
+      double current_limit() const { return _limit; }
+
+      /**
+       * Set the maximum absolute current drawn by the transmission.
+       *
+       * @param current_limit The maximum absolute current drawn by the transmission, in Amps.
+       */
+      void set_current_limit(double current_limit) { _limit = std::abs(current_limit); }
+
+      double nominal_voltage() const override { return _transmission.nominal_voltage(); }
+
+      double get_current(double voltage, double speed) const override {
+        return std::max(-_limit, std::min(_limit, _transmission.get_current(voltage, speed)));
+      }
+
+      double get_torque(double current) const override { return _transmission.get_torque(current); }
+
+      double get_free_speed(double voltage) const override { return _transmission.get_free_speed(voltage); }
+
+      double get_free_voltage(double speed) const override { return _transmission.get_free_voltage(speed); }
+
+      double get_current_voltage(double current) const override {
+        return _transmission.get_current_voltage(current);
+      }
+
+      double get_torque_current(double torque) const override {
+        return _transmission.get_torque_current(torque);
+      }
+
+      void solve_electrical(const double *speed, const double *torque, double *voltage, double *current,
+                            size_t count) const override {
+        _transmission.solve_electrical(speed, torque, voltage, current, count);
+      }
+
+     private:
+      const transmission_t &_transmission;
+      double                _limit;
+    };
+  }  // namespace transmission
+}  // namespace pf
+}  // namespace grpl
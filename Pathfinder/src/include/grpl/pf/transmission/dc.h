@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace grpl {
 namespace pf {
   /**
@@ -84,6 +86,34 @@ namespace pf {
        * @return The nominal, operating voltage of the transmission, in Volts
        */
       virtual double nominal_voltage() const = 0;
+
+      /**
+       * Solve the electrical state (applied voltage and current draw) of the transmission for a batch of
+       * speeds and torques.
+       *
+       * For each element, this is equivalent to summing @ref get_free_voltage(double) const and
+       * @ref get_current_voltage(double) const, with the current given by
+       * @ref get_torque_current(double) const. The default implementation does exactly this, one element
+       * at a time. Transmissions may override this to process the batch in a single pass.
+       *
+       * The output buffers may be the same as the input buffers (in-place), but may not otherwise overlap.
+       *
+       * @param speed   The speeds of the transmission, in rad/s.
+       * @param torque  The torques applied by the transmission, in Nm.
+       * @param voltage Output buffer for the voltages applied to the transmission, in Volts.
+       * @param current Output buffer for the currents drawn by the transmission, in Amps.
+       * @param count   The number of elements in each buffer.
+       */
+      virtual void solve_electrical(const double *speed, const double *torque, double *voltage,
+                                    double *current, size_t count) const {
+        for (size_t i = 0; i < count; i++) {
+          double free_voltage = get_free_voltage(speed[i]);
+          double i_torque     = get_torque_current(torque[i]);
+
+          voltage[i] = free_voltage + get_current_voltage(i_torque);
+          current[i] = i_torque;
+        }
+      }
     };
 
     /**
@@ -92,8 +122,11 @@ namespace pf {
      * Basic DC Motor Model, dervied from the ideal resistive motor model with Back EMF
      * (+ ---[ R ]---( V_w )--- -), where R = V / I_stall (as V_w = 0 at stall), and
      * V_w = kv*w.
+     *
+     * The derived constants (R, kv, kt) are calculated once on construction. The class is final, such
+     * that calls made through a dc_motor (as opposed to a dc_transmission) are not virtual.
      */
-    class dc_motor : public dc_transmission {
+    class dc_motor final : public dc_transmission {
      public:
       /**
        * Construct a DC Brushed Motor Model.
@@ -111,28 +144,31 @@ namespace pf {
             _free_speed(free_speed),
             _free_current(free_current),
             _stall_current(stall_current),
-            _stall_torque(stall_torque) {}
+            _stall_torque(stall_torque),
+            _resistance(v_nom / stall_current),
+            _kv((v_nom - free_current * v_nom / stall_current) / free_speed),
+            _kt(stall_current / stall_torque) {}
 
       /**
        * Calculate the internal resistance of the motor windings
        *
        * @return the internal resistance of the motor, in Ohms
        */
-      inline double internal_resistance() const { return _v_nom / _stall_current; }
+      inline double internal_resistance() const { return _resistance; }
 
       /**
        * Calculate the speed-voltage coefficient of the motor (kv in V = kv*w)
        *
        * @return The speed-voltage coefficient of the motor, in Vs/rad
        */
-      inline double kv() const { return (_v_nom - _free_current * _v_nom / _stall_current) / _free_speed; }
+      inline double kv() const { return _kv; }
 
       /**
        * Calculate the torque-current coefficient of the motor (kt in I = kt*t)
        *
        * @return The torque-current coefficient of the motor, in A/(Nm)
        */
-      inline double kt() const { return _stall_current / _stall_torque; }
+      inline double kt() const { return _kt; }
 
       double nominal_voltage() const override { return _v_nom; }
 
@@ -169,12 +205,27 @@ namespace pf {
         return kt() * torque;
       }
 
+      void solve_electrical(const double *speed, const double *torque, double *voltage, double *current,
+                            size_t count) const override {
+        double kv = _kv, kt = _kt, r = _resistance;
+        for (size_t i = 0; i < count; i++) {
+          // V = kv*w + IR, I = kt * t
+          double w = speed[i], t = torque[i];
+          double I = kt * t;
+
+          voltage[i] = kv * w + I * r;
+          current[i] = I;
+        }
+      }
+
      private:
       double _v_nom = 12;
       double _free_speed;
       double _free_current;
       double _stall_current;
       double _stall_torque;
+      // Derived constants
+      double _resistance, _kv, _kt;
     };
   }  // namespace transmission
 }  // namespace pf
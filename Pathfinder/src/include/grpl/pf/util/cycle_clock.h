@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define GRPL_PF_CYCLE_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define GRPL_PF_CYCLE_RDTSC
+#endif
+
+namespace grpl {
+namespace pf {
+  namespace util {
+
+    /**
+     * Read a cheap, monotonic cycle counter, used to measure the latency of short calls.
+     *
+     * On x86, this is the timestamp counter (rdtsc). On 64-bit ARM, this is the virtual counter
+     * (cntvct_el0). On all other platforms (including the 32-bit ARM of the roboRIO), this falls back to
+     * @ref std::chrono::steady_clock, in its native tick period.
+     *
+     * The unit of the counter depends on the platform, so counts should only be compared with counts from
+     * the same platform.
+     *
+     * @return The current value of the counter.
+     */
+    inline uint64_t cycle_count() {
+#if defined(GRPL_PF_CYCLE_RDTSC)
+      return __rdtsc();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+      uint64_t count;
+      asm volatile("mrs %0, cntvct_el0" : "=r"(count));
+      return count;
+#else
+      return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+  }  // namespace util
+}  // namespace pf
+}  // namespace grpl
+
+#undef GRPL_PF_CYCLE_RDTSC
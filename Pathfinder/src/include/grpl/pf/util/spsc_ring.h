@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace util {
+
+    /**
+     * A fixed-size, lock-free ring buffer with a single producer and a single consumer.
+     *
+     * The ring is used to pass samples out of a real-time thread (the producer) to a monitoring thread
+     * (the consumer) without blocking or allocating on the real-time thread. The storage is allocated on
+     * construction, and neither @ref push() nor @ref pop() allocate, lock or wait. If the ring is full, a
+     * pushed sample is dropped (and counted, see @ref dropped()) rather than blocking the producer.
+     *
+     * Exactly one thread may push and exactly one thread may pop at any one time.
+     *
+     * @param T The type of sample held in the ring. Must be copy-assignable.
+     */
+    template <typename T>
+    class spsc_ring {
+     public:
+      /**
+       * Create a ring buffer.
+       *
+       * @param capacity The minimum number of samples the ring can hold, rounded up to a power of two.
+       */
+      explicit spsc_ring(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) size <<= 1;
+        _buffer.resize(size);
+        _mask = size - 1;
+      }
+
+      spsc_ring(const spsc_ring &) = delete;
+      spsc_ring &operator=(const spsc_ring &) = delete;
+
+      /**
+       * Push a sample into the ring. Only to be called from the producer thread.
+       *
+       * @param value The sample to push.
+       * @return      True if the sample was pushed, false if the ring was full and the sample dropped.
+       */
+      bool push(const T &value) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) > _mask) {
+          _dropped.fetch_add(1, std::memory_order_relaxed);
+          return false;
+        }
+
+        _buffer[head & _mask] = value;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+      }
+
+      /**
+       * Pop the oldest sample from the ring. Only to be called from the consumer thread.
+       *
+       * @param value Written with the popped sample, if any.
+       * @return      True if a sample was popped, false if the ring was empty.
+       */
+      bool pop(T &value) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) return false;
+
+        value = _buffer[tail & _mask];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+      }
+
+      /**
+       * @return The number of samples the ring can hold.
+       */
+      size_t capacity() const { return _mask + 1; }
+
+      /**
+       * @return The number of samples currently in the ring. Only exact when called from the producer or
+       *         consumer thread while the other is idle.
+       */
+      size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+      }
+
+      /**
+       * @return The total number of samples dropped as the ring was full.
+       */
+      size_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+     private:
+      std::vector<T> _buffer;
+      size_t         _mask;
+
+      // The producer and consumer indices are kept on separate cache lines, such that the producer and
+      // consumer do not contend on each write.
+      std::atomic<size_t> _head{0};
+      char                _pad_head[64 - sizeof(std::atomic<size_t>)];
+      std::atomic<size_t> _tail{0};
+      char                _pad_tail[64 - sizeof(std::atomic<size_t>)];
+      std::atomic<size_t> _dropped{0};
+    };
+  }  // namespace util
+}  // namespace pf
+}  // namespace grpl
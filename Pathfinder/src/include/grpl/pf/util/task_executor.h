@@ -0,0 +1,252 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  namespace util {
+
+    /**
+     * A pool of worker threads running queued background tasks, such as generating a trajectory while a
+     * control loop continues on the calling thread.
+     *
+     * Unlike @ref thread_pool, which runs a single parallel loop and blocks the caller until it completes,
+     * tasks are submitted to a queue and run in the background, with a @ref task handle returned to the
+     * caller to poll, wait on or cancel. Urgent tasks (see @ref priority) are run before any normal task
+     * that is still queued, but do not interrupt tasks that are already running.
+     *
+     * Cancellation is cooperative: a queued task is cancelled immediately and never runs, while a running
+     * task is asked to stop, and should poll @ref task::cancel_requested() between stages of its work.
+     *
+     * Submitting a task allocates (the task handle and its function), so tasks should be coarse-grained.
+     */
+    class task_executor {
+     public:
+      /**
+       * The priority of a task.
+       */
+      enum class priority {
+        //! Run in order of submission, after any urgent tasks.
+        normal,
+        //! Run before all normal tasks, such as for a result needed within the current control loop cycle.
+        urgent
+      };
+
+      /**
+       * The status of a task.
+       */
+      enum class status { pending, running, completed, cancelled };
+
+      /**
+       * A handle to a submitted task, shared between the executor and the caller.
+       */
+      class task {
+       public:
+        /**
+         * @return The status of the task.
+         */
+        status get_status() const {
+          std::lock_guard<std::mutex> lock(_mtx);
+          return _status;
+        }
+
+        /**
+         * @return Whether the task is complete or cancelled, such that it will not run (further).
+         */
+        bool done() const {
+          status st = get_status();
+          return st == status::completed || st == status::cancelled;
+        }
+
+        /**
+         * @return Whether cancellation of the task has been requested. Running tasks should poll this and
+         *         return early if it is set.
+         */
+        bool cancel_requested() const { return _cancel.load(std::memory_order_relaxed); }
+
+        /**
+         * Cancel the task. A pending task is cancelled immediately, while a running task is asked to stop
+         * and is marked cancelled once it returns, discarding any result.
+         *
+         * @return Whether the task will not complete, i.e. false if the task had already completed.
+         */
+        bool cancel() {
+          std::lock_guard<std::mutex> lock(_mtx);
+          if (_status == status::completed) return false;
+
+          _cancel.store(true, std::memory_order_relaxed);
+          if (_status == status::pending) {
+            _status = status::cancelled;
+            _cv.notify_all();
+          }
+          return true;
+        }
+
+        /**
+         * Block until the task is complete or cancelled.
+         */
+        void wait() const {
+          std::unique_lock<std::mutex> lock(_mtx);
+          _cv.wait(lock, [this] { return finished(); });
+        }
+
+        /**
+         * Block until the task is complete or cancelled, or until a timeout elapses.
+         *
+         * @param timeout The maximum time to wait.
+         * @return Whether the task is complete or cancelled.
+         */
+        template <typename rep_t, typename period_t>
+        bool wait_for(const std::chrono::duration<rep_t, period_t> &timeout) const {
+          std::unique_lock<std::mutex> lock(_mtx);
+          return _cv.wait_for(lock, timeout, [this] { return finished(); });
+        }
+
+       private:
+        friend class task_executor;
+
+        bool finished() const { return _status == status::completed || _status == status::cancelled; }
+
+        std::function<void(task &)> _fn;
+
+        mutable std::mutex              _mtx;
+        mutable std::condition_variable _cv;
+        status                          _status = status::pending;
+        std::atomic<bool>               _cancel{false};
+      };
+
+      using task_ptr = std::shared_ptr<task>;
+
+      /**
+       * Create a task executor.
+       *
+       * @param workers The number of worker threads. If 0, the number of hardware threads is used.
+       */
+      explicit task_executor(size_t workers = 1) {
+        if (workers == 0) workers = std::thread::hardware_concurrency();
+        if (workers == 0) workers = 1;
+
+        _running.resize(workers);
+        _threads.reserve(workers);
+        for (size_t i = 0; i < workers; i++) _threads.emplace_back(&task_executor::worker_loop, this, i);
+      }
+
+      /**
+       * Destroy the executor. Queued tasks are cancelled, and running tasks are asked to stop and are
+       * waited on.
+       */
+      ~task_executor() {
+        {
+          std::lock_guard<std::mutex> lock(_mtx);
+          _stop = true;
+          for (auto &t : _urgent) t->cancel();
+          for (auto &t : _normal) t->cancel();
+          for (auto &t : _running)
+            if (t) t->cancel();
+          _urgent.clear();
+          _normal.clear();
+        }
+        _wake.notify_all();
+        for (auto &thread : _threads) thread.join();
+      }
+
+      task_executor(const task_executor &) = delete;
+      task_executor &operator=(const task_executor &) = delete;
+
+      /**
+       * @return The number of worker threads.
+       */
+      size_t size() const { return _threads.size(); }
+
+      /**
+       * @return The number of tasks queued and not yet started, including cancelled tasks not yet removed
+       *         from the queue.
+       */
+      size_t queued() const {
+        std::lock_guard<std::mutex> lock(_mtx);
+        return _urgent.size() + _normal.size();
+      }
+
+      /**
+       * Submit a task to run in the background.
+       *
+       * @param fn    The function to run, called as fn(task &) on a worker thread. The function should poll
+       *              @ref task::cancel_requested() and return early if set, and must not throw.
+       * @param prio  The priority of the task.
+       * @return A handle to the task.
+       */
+      template <typename func_t>
+      task_ptr submit(func_t &&fn, priority prio = priority::normal) {
+        task_ptr t = std::make_shared<task>();
+        t->_fn     = std::forward<func_t>(fn);
+        {
+          std::lock_guard<std::mutex> lock(_mtx);
+          if (_stop) {
+            t->cancel();
+            return t;
+          }
+          (prio == priority::urgent ? _urgent : _normal).push_back(t);
+        }
+        _wake.notify_one();
+        return t;
+      }
+
+     private:
+      void worker_loop(size_t worker) {
+        while (true) {
+          task_ptr t;
+          {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _wake.wait(lock, [this] { return _stop || !_urgent.empty() || !_normal.empty(); });
+            if (_stop) return;
+
+            std::deque<task_ptr> &queue = _urgent.empty() ? _normal : _urgent;
+            t                           = std::move(queue.front());
+            queue.pop_front();
+            _running[worker] = t;
+          }
+
+          run(*t);
+
+          std::lock_guard<std::mutex> lock(_mtx);
+          _running[worker].reset();
+        }
+      }
+
+      static void run(task &t) {
+        {
+          std::lock_guard<std::mutex> lock(t._mtx);
+          // Cancelled while queued.
+          if (t._status != status::pending) return;
+          t._status = status::running;
+        }
+
+        t._fn(t);
+        // Release anything held by the function (such as the task's inputs) now that it has run.
+        t._fn = nullptr;
+
+        std::lock_guard<std::mutex> lock(t._mtx);
+        t._status = t.cancel_requested() ? status::cancelled : status::completed;
+        t._cv.notify_all();
+      }
+
+      std::vector<std::thread> _threads;
+      std::vector<task_ptr>    _running;
+
+      mutable std::mutex      _mtx;
+      std::condition_variable _wake;
+      bool                    _stop = false;
+      std::deque<task_ptr>    _urgent, _normal;
+    };
+  }  // namespace util
+}  // namespace pf
+}  // namespace grpl
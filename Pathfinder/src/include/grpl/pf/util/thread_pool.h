@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace grpl {
+namespace pf {
+  /**
+   * Utilities.
+   *
+   * The grpl::pf::util namespace contains general utilities used to support the models and generators,
+   * such as concurrency primitives.
+   */
+  namespace util {
+
+    /**
+     * A fixed-size pool of worker threads, used to run many independent jobs concurrently.
+     *
+     * The pool runs a single parallel loop at a time (see @ref parallel_for). The calling thread
+     * participates in the loop as worker 0, such that a pool of size 1 runs the loop inline without
+     * starting any threads.
+     *
+     * Threads are started on construction and joined on destruction. Running a loop does not allocate.
+     */
+    class thread_pool {
+     public:
+      /**
+       * Create a thread pool.
+       *
+       * @param workers The number of workers in the pool, including the calling thread. If 0, the number
+       *                of hardware threads is used.
+       */
+      explicit thread_pool(size_t workers = 0) {
+        if (workers == 0) workers = std::thread::hardware_concurrency();
+        if (workers == 0) workers = 1;
+
+        _size = workers;
+        _threads.reserve(workers - 1);
+        for (size_t i = 1; i < workers; i++) _threads.emplace_back(&thread_pool::worker_loop, this, i);
+      }
+
+      ~thread_pool() {
+        {
+          std::lock_guard<std::mutex> lock(_mtx);
+          _stop = true;
+        }
+        _wake.notify_all();
+        for (auto &thread : _threads) thread.join();
+      }
+
+      thread_pool(const thread_pool &) = delete;
+      thread_pool &operator=(const thread_pool &) = delete;
+
+      /**
+       * @return The number of workers in the pool, including the calling thread.
+       */
+      size_t size() const { return _size; }
+
+      /**
+       * Run a function for each index in [0, count), distributed over the workers of the pool, blocking
+       * until all indices are complete.
+       *
+       * Indices are handed out one at a time, so jobs of uneven length are balanced across workers. Only
+       * one loop runs at a time; concurrent calls are serialized.
+       *
+       * @param count The number of indices to run.
+       * @param fn    The function to run, called as fn(size_t index, size_t worker), where worker is in the
+       *              range [0, @ref size()). Calls with the same worker are never concurrent, so the worker
+       *              index may be used to select per-worker scratch space.
+       */
+      template <typename func_t>
+      void parallel_for(size_t count, func_t &fn) {
+        std::lock_guard<std::mutex> loop_lock(_loop_mtx);
+
+        {
+          std::lock_guard<std::mutex> lock(_mtx);
+          _invoke  = &invoke<func_t>;
+          _context = &fn;
+          _count   = count;
+          _next.store(0);
+          _active = _threads.size();
+          _generation++;
+        }
+        _wake.notify_all();
+
+        run(0);
+
+        std::unique_lock<std::mutex> lock(_mtx);
+        _done.wait(lock, [this] { return _active == 0; });
+        _invoke  = nullptr;
+        _context = nullptr;
+      }
+
+     private:
+      template <typename func_t>
+      static void invoke(void *context, size_t idx, size_t worker) {
+        (*static_cast<func_t *>(context))(idx, worker);
+      }
+
+      void run(size_t worker) {
+        size_t idx;
+        while ((idx = _next.fetch_add(1)) < _count) _invoke(_context, idx, worker);
+      }
+
+      void worker_loop(size_t worker) {
+        size_t generation = 0;
+        while (true) {
+          {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _wake.wait(lock, [&] { return _stop || _generation != generation; });
+            if (_stop) return;
+            generation = _generation;
+          }
+
+          run(worker);
+
+          {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _active--;
+          }
+          _done.notify_one();
+        }
+      }
+
+      size_t                   _size;
+      std::vector<std::thread> _threads;
+
+      std::mutex              _loop_mtx, _mtx;
+      std::condition_variable _wake, _done;
+      bool                    _stop       = false;
+      size_t                  _generation = 0, _active = 0;
+
+      void (*_invoke)(void *, size_t, size_t) = nullptr;
+      void *              _context            = nullptr;
+      size_t              _count              = 0;
+      std::atomic<size_t> _next{0};
+    };
+  }  // namespace util
+}  // namespace pf
+}  // namespace grpl
@@ -0,0 +1,114 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace grpl::pf;
+
+class BatchSimulator : public ::testing::Test {
+ protected:
+  using chassis_t   = coupled::basic_chassis<transmission::dc_motor, transmission::dc_motor>;
+  using simulator_t = coupled::batch_simulator<chassis_t>;
+
+  void SetUp() override {
+    using hermite_t = path::hermite_quintic;
+
+    std::array<hermite_t::waypoint, 2> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                           hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}};
+    std::vector<hermite_t>             hermites;
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+
+    std::vector<path::augmented_arc2d> curves;
+    path::arc_parameterizer            param;
+    param.configure(0.01, 0.01);
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+    coupled::noncausal_trajectory_generator gen;
+    gen.configure(0.01);
+
+    std::vector<coupled::state> states(4096);
+    size_t n = gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size());
+    ASSERT_TRUE(states[n - 1].finished);
+
+    end = states[n - 1];
+    chassis.split(states.begin(), states.begin() + n, left, right);
+  }
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  chassis_t              chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  coupled::wheel_track left{4096}, right{4096};
+  coupled::state       end;
+};
+
+TEST_F(BatchSimulator, Nominal) {
+  util::thread_pool pool(1);
+  simulator_t       sim(chassis, 1);
+
+  // The voltages of the trajectory exceed the nominal voltage in corners, so the battery is not limited.
+  std::array<simulator_t::parameters, 1> params{sim.nominal()};
+  params[0].battery_voltage = 100;
+  ASSERT_EQ(1, sim.set_parameters(params.begin(), params.end()));
+
+  sim.simulate(pool, left, right);
+
+  // The nominal robot follows the trajectory.
+  ASSERT_LT(sim.max_error()[0], 0.02);
+  ASSERT_NEAR(end.config.x(), sim.x()[0], 0.02);
+  ASSERT_NEAR(end.config.y(), sim.y()[0], 0.02);
+  ASSERT_NEAR(end.config[2], sim.heading()[0], 0.02);
+}
+
+TEST_F(BatchSimulator, MonteCarlo) {
+  simulator_t sim(chassis, 300);
+
+  std::mt19937                     rng(1234);
+  std::normal_distribution<double> mass(25.0, 2.0), wheel(0.0762, 0.001), battery(12.0, 0.3);
+
+  std::vector<simulator_t::parameters> params;
+  for (int i = 0; i < 300; i++)
+    params.push_back(simulator_t::parameters{mass(rng), wheel(rng), battery(rng)});
+
+  // A heavier robot strays from the trajectory, and more so with a low battery.
+  params[0] = simulator_t::parameters{25.0, 0.0762, 100};
+  params[1] = simulator_t::parameters{35.0, 0.0762, 100};
+  params[2] = simulator_t::parameters{35.0, 0.0762, 9.0};
+  ASSERT_EQ(300, sim.set_parameters(params.begin(), params.end()));
+
+  util::thread_pool single(1), multi(4);
+  sim.simulate(single, left, right);
+  std::vector<double> error(sim.max_error().data(), sim.max_error().data() + sim.size());
+  std::vector<double> x(sim.x().data(), sim.x().data() + sim.size());
+
+  ASSERT_LT(error[0], error[1]);
+  ASSERT_LT(error[1], error[2]);
+
+  // Simulations are independent of the number of threads, and repeatable.
+  sim.simulate(multi, left, right);
+  for (size_t i = 0; i < sim.size(); i++) {
+    ASSERT_EQ(error[i], sim.max_error()[i]) << "Robot: " << i;
+    ASSERT_EQ(x[i], sim.x()[i]) << "Robot: " << i;
+  }
+}
+
+TEST_F(BatchSimulator, Substeps) {
+  util::thread_pool pool(1);
+  simulator_t       sim(chassis, 1);
+
+  std::array<simulator_t::parameters, 1> params{simulator_t::parameters{30.0, 0.075, 11.0}};
+  sim.set_parameters(params.begin(), params.end());
+
+  // The integration converges as the step shrinks.
+  sim.set_substeps(1);
+  sim.simulate(pool, left, right);
+  double x1 = sim.x()[0];
+
+  sim.set_substeps(16);
+  sim.simulate(pool, left, right);
+  ASSERT_NEAR(x1, sim.x()[0], 1e-6);
+}
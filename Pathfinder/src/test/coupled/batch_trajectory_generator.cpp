@@ -0,0 +1,103 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace grpl::pf;
+
+TEST(BatchTrajectoryGenerator, MatchesSequential) {
+  using hermite_t = path::hermite_quintic;
+  using batch_t   = coupled::batch_trajectory_generator<>;
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+  profile::trapezoidal   profile;
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  // Candidate paths, each ending at a different point.
+  const size_t                                    N = 9;
+  std::vector<std::array<hermite_t::waypoint, 2>> paths(N);
+  std::vector<batch_t::request>                   requests(N);
+  std::vector<batch_t::result>                    results(N);
+  std::vector<std::vector<coupled::state>>        trajectories(N, std::vector<coupled::state>(1000));
+
+  for (size_t i = 0; i < N; i++) {
+    paths[i] = {hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                hermite_t::waypoint{{4, 2 + 0.25 * i}, {0, 5}, {0, 0}}};
+    requests[i].waypoints      = paths[i].data();
+    requests[i].waypoint_count = paths[i].size();
+    requests[i].trajectory     = trajectories[i].data();
+    requests[i].max_states     = trajectories[i].size();
+  }
+
+  util::thread_pool pool(3);
+  batch_t           batch(pool, chassis, profile, param, 8, 2048, 0.01, 10);
+  batch.generate(requests.data(), results.data(), N);
+
+  for (size_t i = 0; i < N; i++) {
+    // Run the same pipeline sequentially.
+    std::vector<hermite_t>             hermites;
+    std::vector<path::augmented_arc2d> curves;
+    path::hermite_factory::generate<hermite_t>(paths[i].begin(), paths[i].end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+    profile::trapezoidal                 seq_profile;
+    coupled::causal_trajectory_generator gen;
+    coupled::state                       st;
+    size_t                               count = 0;
+    double                               peak  = 0;
+
+    for (double t = 0; !st.finished && t <= 10; t += 0.01) {
+      st = gen.generate(chassis, curves.begin(), curves.end(), seq_profile, st, t);
+      ASSERT_DOUBLE_EQ(st.kinematics[POSITION], trajectories[i][count].kinematics[POSITION]) << "Path: " << i;
+      count++;
+
+      auto split = chassis.split(st);
+      peak       = std::max(peak, std::max(std::abs(split.first.current), std::abs(split.second.current)));
+    }
+
+    ASSERT_FALSE(results[i].overrun) << "Path: " << i;
+    ASSERT_EQ(st.finished, results[i].finished) << "Path: " << i;
+    ASSERT_EQ(count, results[i].state_count) << "Path: " << i;
+    ASSERT_DOUBLE_EQ(st.time, results[i].time) << "Path: " << i;
+    ASSERT_DOUBLE_EQ(peak, results[i].peak_current) << "Path: " << i;
+  }
+}
+
+TEST(BatchTrajectoryGenerator, Overrun) {
+  using hermite_t = path::hermite_quintic;
+  using batch_t   = coupled::batch_trajectory_generator<>;
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  std::array<hermite_t::waypoint, 2> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                         hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}};
+
+  batch_t::request req;
+  req.waypoints      = wps.data();
+  req.waypoint_count = wps.size();
+
+  util::thread_pool pool(1);
+  batch_t::result   res;
+
+  // Not enough curves
+  batch_t small_curves(pool, chassis, profile::trapezoidal{}, param, 8, 16, 0.01);
+  small_curves.generate(&req, &res, 1);
+  ASSERT_TRUE(res.overrun);
+
+  // Not enough waypoints
+  batch_t small_waypoints(pool, chassis, profile::trapezoidal{}, param, 1, 4096, 0.01);
+  small_waypoints.generate(&req, &res, 1);
+  ASSERT_TRUE(res.overrun);
+}
@@ -97,4 +97,53 @@ TEST(CDT, basic) {
 
     echo_simulation(pathfile, t, centre);
   }
-}
\ No newline at end of file
+}
+TEST(CDT, SharedProfile) {
+  using hermite_t = path::hermite_quintic;
+
+  std::array<std::vector<path::augmented_arc2d>, 2> curves;
+  std::array<std::array<hermite_t::waypoint, 2>, 2> wps{
+      std::array<hermite_t::waypoint, 2>{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                         hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}},
+      std::array<hermite_t::waypoint, 2>{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                         hermite_t::waypoint{{3, -2}, {5, 0}, {0, 0}}}};
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+
+  for (size_t i = 0; i < 2; i++) {
+    std::vector<hermite_t> hermites;
+    path::hermite_factory::generate<hermite_t>(wps[i].begin(), wps[i].end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+    path::arc_parameterizer::context ctx;
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves[i]), curves[i].max_size(),
+                       ctx);
+    ASSERT_FALSE(ctx.overrun);
+  }
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  // Two trajectories generated in lockstep against the same (const) generator and profile must match
+  // those generated separately, each with their own mutable profile.
+  const profile::trapezoidal                          shared_profile;
+  const coupled::causal_trajectory_generator          shared_gen{};
+  std::array<profile::trapezoidal::context, 2>        ctx;
+  std::array<coupled::state, 2>                       shared_state, own_state;
+  std::array<profile::trapezoidal, 2>                 own_profile;
+  std::array<coupled::causal_trajectory_generator, 2> own_gen;
+
+  for (double t = 0; t < 5; t += 0.01) {
+    for (size_t i = 0; i < 2; i++) {
+      auto begin = curves[i].begin(), end = curves[i].end();
+
+      shared_state[i] = shared_gen.generate(chassis, begin, end, shared_profile, ctx[i], shared_state[i], t);
+      own_state[i]    = own_gen[i].generate(chassis, begin, end, own_profile[i], own_state[i], t);
+
+      ASSERT_EQ(own_state[i].finished, shared_state[i].finished) << "Path: " << i << " Time: " << t;
+      ASSERT_EQ(own_state[i].kinematics, shared_state[i].kinematics) << "Path: " << i << " Time: " << t;
+      ASSERT_EQ(own_profile[i].get_limits(), ctx[i].limits) << "Path: " << i << " Time: " << t;
+    }
+  }
+}
@@ -0,0 +1,104 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace grpl::pf;
+
+TEST(Chassis, Devirtualized) {
+  double                 G = 12.75;
+  transmission::dc_motor left{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0, 2 * 2.41 * G};
+  transmission::dc_motor right{12.0, 5330 * 2.0 * constants::PI / 60.0 / 10.71, 2 * 2.7, 2 * 131.0,
+                               2 * 2.41 * 10.71};
+
+  using devirt_chassis_t = coupled::basic_chassis<transmission::dc_motor, transmission::dc_motor>;
+
+  coupled::chassis chassis{left, right, 0.0762, 0.5, 25.0};
+  devirt_chassis_t devirt{left, right, 0.0762, 0.5, 25.0};
+
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+
+  for (double k = -3; k <= 3; k += 0.25) {
+    ASSERT_DOUBLE_EQ(chassis.linear_vel_limit(config, k), devirt.linear_vel_limit(config, k));
+
+    for (double v = -3; v <= 3; v += 0.5) {
+      auto a = chassis.acceleration_limits(config, k, v), b = devirt.acceleration_limits(config, k, v);
+      ASSERT_DOUBLE_EQ(a.first, b.first);
+      ASSERT_DOUBLE_EQ(a.second, b.second);
+
+      coupled::state centre;
+      centre.curvature                = k;
+      centre.dcurvature               = 0.1;
+      centre.config                   = coupled::configuration_state{1, 2, 0.3};
+      centre.kinematics[VELOCITY]     = v;
+      centre.kinematics[ACCELERATION] = a.second / 2;
+
+      auto sa = chassis.split(centre), sb = devirt.split(centre);
+      ASSERT_DOUBLE_EQ(sa.first.voltage, sb.first.voltage);
+      ASSERT_DOUBLE_EQ(sa.first.current, sb.first.current);
+      ASSERT_DOUBLE_EQ(sa.second.voltage, sb.second.voltage);
+      ASSERT_DOUBLE_EQ(sa.second.current, sb.second.current);
+      ASSERT_DOUBLE_EQ(sa.second.kinematics[VELOCITY], sb.second.kinematics[VELOCITY]);
+    }
+  }
+}
+
+template <typename chassis_t>
+static void batch_split_matches(const chassis_t &chassis) {
+  std::vector<coupled::state> states(37);
+  for (size_t i = 0; i < states.size(); i++) {
+    coupled::state &st          = states[i];
+    st.time                     = i * 0.02;
+    st.curvature                = -2 + 0.11 * i;
+    st.dcurvature               = 0.3 - 0.01 * i;
+    st.config                   = coupled::configuration_state{0.1 * i, -0.05 * i, -3 + 0.17 * i};
+    st.kinematics[POSITION]     = 0.03 * i;
+    st.kinematics[VELOCITY]     = 0.1 * i;
+    st.kinematics[ACCELERATION] = 2 - 0.1 * i;
+  }
+  states.back().finished = true;
+
+  // Tracks may differ in capacity.
+  coupled::wheel_track left(64), right(40);
+  ASSERT_EQ(states.size(), chassis.split(states.begin(), states.end(), left, right));
+  ASSERT_EQ(states.size(), left.size());
+  ASSERT_TRUE(left.finished());
+
+  for (size_t i = 0; i < states.size(); i++) {
+    auto expected = chassis.split(states[i]);
+
+    std::array<std::pair<coupled::wheel_state, coupled::wheel_state>, 2> pairs{
+        std::make_pair(expected.first, left.get_state(i)),
+        std::make_pair(expected.second, right.get_state(i))};
+
+    for (auto &pair : pairs) {
+      const coupled::wheel_state &exp = pair.first, &act = pair.second;
+
+      ASSERT_DOUBLE_EQ(exp.time, act.time) << "State: " << i;
+      ASSERT_NEAR(exp.position.x(), act.position.x(), 1e-12) << "State: " << i;
+      ASSERT_NEAR(exp.position.y(), act.position.y(), 1e-12) << "State: " << i;
+      ASSERT_DOUBLE_EQ(exp.kinematics[VELOCITY], act.kinematics[VELOCITY]) << "State: " << i;
+      ASSERT_DOUBLE_EQ(exp.kinematics[ACCELERATION], act.kinematics[ACCELERATION]) << "State: " << i;
+      ASSERT_DOUBLE_EQ(exp.voltage, act.voltage) << "State: " << i;
+      ASSERT_DOUBLE_EQ(exp.current, act.current) << "State: " << i;
+      ASSERT_EQ(exp.finished, act.finished) << "State: " << i;
+    }
+  }
+
+  coupled::wheel_track small(10);
+  ASSERT_EQ(10, chassis.split(states.begin(), states.end(), left, small));
+  ASSERT_FALSE(small.finished());
+}
+
+TEST(Chassis, BatchSplit) {
+  transmission::dc_motor left{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                              2 * 2.41 * 12.75};
+  transmission::dc_motor right{12.0, 5330 * 2.0 * constants::PI / 60.0 / 10.71, 2 * 2.7, 2 * 131.0,
+                               2 * 2.41 * 10.71};
+
+  batch_split_matches(coupled::chassis{left, right, 0.0762, 0.5, 25.0});
+  batch_split_matches(
+      coupled::basic_chassis<transmission::dc_motor, transmission::dc_motor>{left, right, 0.0762, 0.5, 25.0});
+}
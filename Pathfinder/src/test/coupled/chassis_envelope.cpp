@@ -0,0 +1,99 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace grpl::pf;
+
+static transmission::dc_motor dual_cim(double G) {
+  return transmission::dc_motor{12.0, 5330 * 2.0 * constants::PI / 60.0 / G, 2 * 2.7, 2 * 131.0,
+                                2 * 2.41 * G};
+}
+
+static void check_envelope(const coupled::chassis &chassis, const coupled::chassis_envelope &envelope,
+                           double tolerance) {
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+
+  ASSERT_LE(envelope.max_error(), tolerance);
+
+  std::array<double, 13> curvatures{0, 1e-12, 0.01, -0.01, 0.5, -0.5, 1.9, -2.1, 10, -10, 1e3, -1e3, 1e11};
+  for (double k : curvatures) {
+    double vlim = chassis.linear_vel_limit(config, k);
+    ASSERT_NEAR(vlim, envelope.linear_vel_limit(config, k), tolerance) << "Curvature: " << k;
+
+    for (double frac = -1.2; frac <= 1.2; frac += 0.05) {
+      double v     = frac * vlim;
+      auto   exact = chassis.acceleration_limits(config, k, v);
+      auto   lut   = envelope.acceleration_limits(config, k, v);
+
+      ASSERT_NEAR(exact.first, lut.first, tolerance) << "Curvature: " << k << " Velocity: " << v;
+      ASSERT_NEAR(exact.second, lut.second, tolerance) << "Curvature: " << k << " Velocity: " << v;
+    }
+  }
+}
+
+TEST(ChassisEnvelope, Symmetric) {
+  transmission::dc_motor motor = dual_cim(12.75);
+  coupled::chassis       chassis{motor, motor, 0.0762, 0.5, 25.0};
+
+  coupled::chassis_envelope envelope{chassis, 1e-4};
+  check_envelope(chassis, envelope, 1e-4);
+}
+
+TEST(ChassisEnvelope, Asymmetric) {
+  transmission::dc_motor left = dual_cim(12.75), right = dual_cim(10.71);
+  coupled::chassis       chassis{left, right, 0.0762, 0.4, 40.0};
+
+  coupled::chassis_envelope envelope{chassis, 1e-3};
+  check_envelope(chassis, envelope, 1e-3);
+}
+
+TEST(ChassisEnvelope, Stale) {
+  transmission::dc_motor left = dual_cim(12.75), right = dual_cim(12.75);
+  coupled::chassis       chassis{left, right, 0.0762, 0.5, 25.0};
+
+  coupled::chassis_envelope envelope{chassis};
+  ASSERT_FALSE(envelope.stale());
+  ASSERT_FALSE(envelope.update());
+
+  left = dual_cim(8.45);
+  ASSERT_TRUE(envelope.stale());
+  ASSERT_TRUE(envelope.update());
+  ASSERT_FALSE(envelope.stale());
+
+  check_envelope(chassis, envelope, 1e-3);
+}
+
+TEST(ChassisEnvelope, Generator) {
+  using hermite_t = path::hermite_quintic;
+
+  std::vector<path::augmented_arc2d> curves;
+  std::array<hermite_t::waypoint, 2> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                         hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}};
+
+  std::vector<hermite_t> hermites;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             hermites.max_size());
+
+  path::arc_parameterizer param;
+  param.configure(0.01, 0.01);
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+  transmission::dc_motor    motor = dual_cim(12.75);
+  coupled::chassis          chassis{motor, motor, 0.0762, 0.5, 25.0};
+  coupled::chassis_envelope envelope{chassis, 1e-4};
+
+  coupled::causal_trajectory_generator gen;
+  profile::trapezoidal                 p_exact, p_envelope;
+  coupled::state                       s_exact, s_envelope;
+
+  for (double t = 0; !s_exact.finished && t < 5; t += 0.01) {
+    s_exact    = gen.generate(chassis, curves.begin(), curves.end(), p_exact, s_exact, t);
+    s_envelope = gen.generate(envelope, curves.begin(), curves.end(), p_envelope, s_envelope, t);
+
+    ASSERT_NEAR(s_exact.kinematics[POSITION], s_envelope.kinematics[POSITION], 1e-3) << "Time: " << t;
+    ASSERT_NEAR(s_exact.kinematics[VELOCITY], s_envelope.kinematics[VELOCITY], 1e-3) << "Time: " << t;
+  }
+}
@@ -0,0 +1,133 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace grpl::pf;
+
+class Constraints : public ::testing::Test {
+ protected:
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  coupled::configuration_state config = coupled::configuration_state::Zero();
+  std::array<double, 9>        curvatures{0, 0.01, -0.01, 0.5, -0.5, 1.9, -2.1, 10, -10};
+};
+
+TEST_F(Constraints, Unconstrained) {
+  auto constrained = coupled::make_constrained_chassis(chassis);
+
+  for (double k : curvatures) {
+    double vlim = chassis.linear_vel_limit(config, k);
+    ASSERT_EQ(vlim, constrained.linear_vel_limit(config, k)) << "Curvature: " << k;
+
+    for (double frac = -1.2; frac <= 1.2; frac += 0.1) {
+      double v = frac * vlim;
+      ASSERT_EQ(chassis.acceleration_limits(config, k, v), constrained.acceleration_limits(config, k, v))
+          << "Curvature: " << k << " Velocity: " << v;
+    }
+  }
+}
+
+TEST_F(Constraints, Centripetal) {
+  auto constrained = coupled::make_constrained_chassis(chassis, coupled::centripetal_constraint(2.0));
+
+  for (double k : curvatures) {
+    double expected = chassis.linear_vel_limit(config, k);
+    if (k != 0) expected = std::min(expected, std::sqrt(2.0 / std::abs(k)));
+
+    ASSERT_DOUBLE_EQ(expected, constrained.linear_vel_limit(config, k)) << "Curvature: " << k;
+    ASSERT_EQ(chassis.acceleration_limits(config, k, 1), constrained.acceleration_limits(config, k, 1))
+        << "Curvature: " << k;
+  }
+}
+
+TEST_F(Constraints, Current) {
+  // The current constraint matches a chassis with current limited transmissions. Below the free speed, the
+  // current drawn is positive on both sides, and clamped by the limit.
+  transmission::current_limited<transmission::dc_motor> limitedCIM{dualCIM, 120};
+  coupled::chassis                                      limited{limitedCIM, limitedCIM, 0.0762, 0.5, 25.0};
+
+  auto constrained =
+      coupled::make_constrained_chassis(chassis, coupled::current_constraint<coupled::chassis>(chassis, 120));
+
+  for (double k : {0.0, 0.5, -0.5}) {
+    double vlim = chassis.linear_vel_limit(config, k);
+    ASSERT_EQ(vlim, constrained.linear_vel_limit(config, k));
+
+    for (double frac = 0; frac <= 0.9; frac += 0.1) {
+      double v        = frac * vlim;
+      auto   expected = limited.acceleration_limits(config, k, v);
+      auto   actual   = constrained.acceleration_limits(config, k, v);
+
+      ASSERT_NEAR(expected.first, actual.first, 1e-9) << "Curvature: " << k << " Velocity: " << v;
+      ASSERT_NEAR(expected.second, actual.second, 1e-9) << "Curvature: " << k << " Velocity: " << v;
+    }
+  }
+
+  // Changing the limit takes effect on the next call.
+  double max_120 = constrained.acceleration_limits(config, 0, 0).second;
+  constrained.constraint<0>().set_current_limit(60);
+  ASSERT_NEAR(max_120 / 2, constrained.acceleration_limits(config, 0, 0).second, 1e-9);
+}
+
+TEST_F(Constraints, Voltage) {
+  coupled::voltage_constraint<coupled::chassis> nominal(chassis, 12.0);
+  coupled::voltage_constraint<coupled::chassis> sagging(chassis, 9.0);
+
+  for (double k : curvatures) {
+    double vlim = chassis.linear_vel_limit(config, k);
+    ASSERT_NEAR(vlim, nominal.velocity_limit(config, k), 1e-9) << "Curvature: " << k;
+    ASSERT_NEAR(vlim * 0.75, sagging.velocity_limit(config, k), 1e-9) << "Curvature: " << k;
+
+    for (double frac = -1.2; frac <= 1.2; frac += 0.1) {
+      double v        = frac * vlim;
+      auto   expected = chassis.acceleration_limits(config, k, v);
+      auto   actual   = nominal.acceleration_limits(config, k, v);
+
+      ASSERT_NEAR(expected.first, actual.first, 1e-9) << "Curvature: " << k << " Velocity: " << v;
+      ASSERT_NEAR(expected.second, actual.second, 1e-9) << "Curvature: " << k << " Velocity: " << v;
+      ASSERT_LT(sagging.acceleration_limits(config, k, v).second, actual.second) << "Curvature: " << k;
+    }
+  }
+}
+
+TEST_F(Constraints, Generate) {
+  using hermite_t = path::hermite_quintic;
+
+  std::array<hermite_t::waypoint, 2> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                         hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}};
+  std::vector<hermite_t>             hermites;
+  path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                             hermites.max_size());
+
+  std::vector<path::augmented_arc2d> curves;
+  path::arc_parameterizer            param;
+  param.configure(0.01, 0.01);
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+  // All three constraints composed, with the centripetal acceleration respected over the whole trajectory.
+  using current_t  = coupled::current_constraint<coupled::chassis>;
+  using voltage_t  = coupled::voltage_constraint<coupled::chassis>;
+  auto constrained = coupled::make_constrained_chassis(chassis, coupled::centripetal_constraint(1.5),
+                                                       current_t(chassis, 80), voltage_t(chassis, 11));
+
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.01);
+
+  std::vector<coupled::state> states(4096), unconstrained(4096);
+  size_t n = gen.generate(constrained, curves.begin(), curves.end(), states.begin(), states.size());
+  size_t m = gen.generate(chassis, curves.begin(), curves.end(), unconstrained.begin(), unconstrained.size());
+  ASSERT_EQ(n, m);
+  ASSERT_TRUE(states[n - 1].finished);
+
+  for (size_t i = 0; i < n; i++) {
+    double v = states[i].kinematics[VELOCITY];
+    ASSERT_LE(v * v * std::abs(states[i].curvature), 1.5 + 1e-6) << "Index: " << i;
+  }
+  ASSERT_GT(states[n - 1].time, unconstrained[n - 1].time);
+}
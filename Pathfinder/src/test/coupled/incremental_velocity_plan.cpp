@@ -0,0 +1,58 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace grpl::pf;
+
+TEST(IncrementalVelocityPlan, MatchesNoncausal) {
+  using hermite_t = path::hermite_quintic;
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+  param.configure(0.05, 0.05);
+
+  std::vector<hermite_t::waypoint> wps;
+  for (int i = 0; i < 20; i++) wps.push_back(hermite_t::waypoint{{2.0 * i, i % 2}, {3, 0}, {0, 0}});
+
+  path::incremental_path<hermite_t>    path(param);
+  coupled::incremental_velocity_plan<> plan(chassis, 0.05);
+
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.05);
+
+  path.set_waypoints(wps.begin(), wps.end());
+  double from = path.update();
+  ASSERT_EQ(0, from);
+  size_t recalculated = plan.update(path.begin(), path.end(), from);
+  ASSERT_EQ(plan.size(), recalculated);
+
+  // Move waypoints near the end, the middle, and the start of the path in turn, and finally extend it.
+  std::vector<size_t> moves{17, 10, 1, 19};
+  for (size_t idx : moves) {
+    wps[idx].position += hermite_t::vector_t{0.3, 0.5};
+    path.set_waypoint(idx, wps[idx]);
+    if (idx == 19) path.set_waypoint(19, hermite_t::waypoint{{40, 3}, {3, 0}, {0, 0}});
+
+    from         = path.update();
+    recalculated = plan.update(path.begin(), path.end(), from);
+    if (idx == 17) {
+      ASSERT_LT(recalculated, plan.size() / 2);
+    }
+
+    std::vector<coupled::state> states(gen.state_count(path.begin(), path.end()));
+    ASSERT_EQ(states.size(), gen.generate(chassis, path.begin(), path.end(), states.begin(), states.size()));
+    ASSERT_EQ(states.size(), plan.size());
+
+    for (size_t i = 0; i < states.size(); i++) {
+      ASSERT_EQ(states[i].time, plan[i].time) << "Waypoint: " << idx << " State: " << i;
+      ASSERT_EQ(states[i].config, plan[i].config) << "Waypoint: " << idx << " State: " << i;
+      ASSERT_EQ(states[i].kinematics, plan[i].kinematics) << "Waypoint: " << idx << " State: " << i;
+      ASSERT_EQ(states[i].finished, plan[i].finished) << "Waypoint: " << idx << " State: " << i;
+    }
+  }
+}
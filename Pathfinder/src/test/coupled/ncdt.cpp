@@ -0,0 +1,80 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace grpl::pf;
+
+class NCDT : public ::testing::Test {
+ protected:
+  using hermite_t = path::hermite_quintic;
+
+  void SetUp() override {
+    std::array<hermite_t::waypoint, 2> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                           hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}};
+
+    std::vector<hermite_t> hermites;
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+
+    path::arc_parameterizer param;
+    param.configure(0.01, 0.01);
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+    for (auto &c : curves) total_length += c.length();
+  }
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::augmented_arc2d> curves;
+  double                             total_length = 0;
+};
+
+TEST_F(NCDT, basic) {
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.01);
+
+  size_t                      count = gen.state_count(curves.begin(), curves.end());
+  std::vector<coupled::state> states(count);
+
+  ASSERT_EQ(count, gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size()));
+
+  const coupled::state &first = states.front(), &last = states.back();
+
+  ASSERT_DOUBLE_EQ(0, first.time);
+  ASSERT_DOUBLE_EQ(0, first.kinematics[POSITION]);
+  ASSERT_DOUBLE_EQ(0, first.kinematics[VELOCITY]);
+  ASSERT_FALSE(first.finished);
+
+  ASSERT_DOUBLE_EQ(total_length, last.kinematics[POSITION]);
+  ASSERT_DOUBLE_EQ(0, last.kinematics[VELOCITY]);
+  ASSERT_TRUE(last.finished);
+  ASSERT_NEAR(4, last.config.x(), 0.01);
+  ASSERT_NEAR(4, last.config.y(), 0.01);
+
+  for (size_t i = 1; i < count; i++) {
+    const coupled::state &prev = states[i - 1], &st = states[i];
+
+    ASSERT_GT(st.time, prev.time) << "State: " << i;
+    ASSERT_GT(st.kinematics[POSITION], prev.kinematics[POSITION]) << "State: " << i;
+    ASSERT_LE(st.kinematics[VELOCITY], chassis.linear_vel_limit(st.config, st.curvature) + 1e-9)
+        << "State: " << i;
+
+    auto limits = chassis.acceleration_limits(prev.config, prev.curvature, prev.kinematics[VELOCITY]);
+    ASSERT_LE(st.kinematics[ACCELERATION], limits.second + 1e-6) << "State: " << i;
+  }
+}
+
+TEST_F(NCDT, buffer_too_small) {
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.05);
+
+  size_t                      count = gen.state_count(curves.begin(), curves.end());
+  std::vector<coupled::state> states(count - 1);
+
+  ASSERT_EQ(0, gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size()));
+}
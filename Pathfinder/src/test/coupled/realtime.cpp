@@ -0,0 +1,86 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace grpl::pf;
+
+class Realtime : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    using hermite_t = path::hermite_quintic;
+
+    std::array<hermite_t::waypoint, 3> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                           hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}},
+                                           hermite_t::waypoint{{6, 6}, {5, 0}, {0, 0}}};
+
+    std::vector<hermite_t> hermites;
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+
+    path::arc_parameterizer param;
+    param.configure(0.01, 0.01);
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+    ASSERT_FALSE(param.has_overrun());
+  }
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::augmented_arc2d> curves;
+};
+
+TEST_F(Realtime, MatchesCausal) {
+  const coupled::causal_trajectory_generator   causal{};
+  const coupled::realtime_trajectory_generator realtime(curves.begin(), curves.end());
+  const profile::trapezoidal                   profile;
+
+  ASSERT_EQ(curves.size(), realtime.curve_count());
+
+  profile::trapezoidal::context ctx_causal, ctx_realtime;
+  coupled::state                st_causal, st_realtime;
+
+  double t;
+  for (t = 0; !st_realtime.finished && t < 10; t += 0.01) {
+    st_causal   = causal.generate(chassis, curves.begin(), curves.end(), profile, ctx_causal, st_causal, t);
+    st_realtime = realtime.generate(chassis, profile, ctx_realtime, st_realtime, t);
+
+    ASSERT_EQ(st_causal.finished, st_realtime.finished) << "Time: " << t;
+    ASSERT_EQ(st_causal.kinematics, st_realtime.kinematics) << "Time: " << t;
+    ASSERT_EQ(st_causal.config, st_realtime.config) << "Time: " << t;
+    ASSERT_EQ(ctx_causal.limits, ctx_realtime.limits) << "Time: " << t;
+  }
+
+  ASSERT_NEAR(realtime.length(), st_realtime.kinematics[POSITION], 0.01);
+}
+
+TEST_F(Realtime, Latency) {
+  coupled::realtime_trajectory_generator realtime(curves.begin(), curves.end());
+  coupled::realtime_trajectory_generator::ring_t ring(1024);
+  realtime.set_latency_ring(&ring);
+
+  // A missed cycle (large dt) is bounded to the maximum slice count.
+  profile::trapezoidal profile;
+  profile.set_max_slices(10);
+
+  profile::trapezoidal::context ctx;
+  coupled::state                st;
+
+  size_t calls = 0;
+  for (double t = 0; !st.finished && t < 10; t += (calls % 50 == 49 ? 0.1 : 0.01), calls++)
+    st = realtime.generate(chassis, profile, ctx, st, t);
+
+  ASSERT_TRUE(st.finished);
+  ASSERT_EQ(calls, ring.size() + ring.dropped());
+  ASSERT_EQ(0, ring.dropped());
+
+  coupled::realtime_trajectory_generator::latency_sample sample;
+  double                                                 last_time = -1;
+  while (ring.pop(sample)) {
+    ASSERT_GT(sample.time, last_time);
+    last_time = sample.time;
+  }
+}
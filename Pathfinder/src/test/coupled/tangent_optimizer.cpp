@@ -0,0 +1,104 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace grpl::pf;
+
+class TangentOptimizer : public ::testing::Test {
+ protected:
+  using hermite_t   = path::hermite_quintic;
+  using limited_t   = transmission::current_limited<transmission::dc_motor>;
+  using chassis_t   = coupled::basic_chassis<limited_t, limited_t>;
+  using optimizer_t = coupled::tangent_optimizer<hermite_t, chassis_t>;
+
+  void SetUp() override { param.configure(0.05, 0.05); }
+
+  // Estimate the trajectory time of a path from scratch, without reusing any segments.
+  double estimate(const std::array<hermite_t::waypoint, 3> &wps) {
+    std::vector<hermite_t>             hermites;
+    std::vector<path::augmented_arc2d> curves;
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+    coupled::noncausal_trajectory_generator gen;
+    gen.configure(0.05);
+    std::vector<coupled::state> states(gen.state_count(curves.begin(), curves.end()));
+    size_t count = gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size());
+    return states[count - 1].time;
+  }
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  limited_t              limited{dualCIM, 120};
+  chassis_t              chassis{limited, limited, 0.0762, 0.5, 25.0};
+
+  path::arc_parameterizer param;
+
+  // A path with poorly chosen (short) tangents, resulting in tight corners.
+  std::array<hermite_t::waypoint, 3> initial{hermite_t::waypoint{{0, 0}, {1, 0}, {0, 0}},
+                                             hermite_t::waypoint{{2, 1}, {0, 1}, {0, 0}},
+                                             hermite_t::waypoint{{4, 4}, {0, 1}, {0, 0}}};
+};
+
+TEST_F(TangentOptimizer, Improves) {
+  util::thread_pool pool(3);
+  optimizer_t       optimizer(pool, chassis, param, 8, 1024, 4096);
+  optimizer.configure(0.05);
+
+  std::array<hermite_t::waypoint, 3> wps = initial;
+  optimizer_t::result                res = optimizer.optimize(wps.data(), wps.size());
+
+  ASSERT_FALSE(res.overrun);
+  ASSERT_GT(res.iterations, 0);
+  ASSERT_LT(res.time, res.initial_time);
+  ASSERT_NEAR(estimate(initial), res.initial_time, 1e-9);
+  ASSERT_NEAR(estimate(wps), res.time, 1e-9);
+
+  // The start and end headings are kept.
+  ASSERT_NEAR(0, std::atan2(wps[0].tangent.y(), wps[0].tangent.x()), 1e-12);
+  ASSERT_NEAR(constants::PI / 2, std::atan2(wps[2].tangent.y(), wps[2].tangent.x()), 1e-12);
+  ASSERT_TRUE(res.within_current_limit);
+}
+
+TEST_F(TangentOptimizer, CurrentLimit) {
+  util::thread_pool pool(2);
+  optimizer_t       optimizer(pool, chassis, param, 8, 1024, 4096);
+  optimizer.configure(0.05);
+  optimizer.set_max_current(300);
+
+  std::array<hermite_t::waypoint, 3> wps = initial;
+  optimizer_t::result                res = optimizer.optimize(wps.data(), wps.size());
+
+  ASSERT_FALSE(res.overrun);
+  ASSERT_TRUE(res.within_current_limit);
+  ASSERT_LE(res.peak_current, 300);
+}
+
+TEST_F(TangentOptimizer, Deterministic) {
+  util::thread_pool pool1(1), pool3(3);
+  optimizer_t       seq(pool1, chassis, param, 8, 1024, 4096), par(pool3, chassis, param, 8, 1024, 4096);
+  seq.configure(0.05, 20);
+  par.configure(0.05, 20);
+
+  std::array<hermite_t::waypoint, 3> a = initial, b = initial;
+  optimizer_t::result                ra = seq.optimize(a.data(), a.size()), rb = par.optimize(b.data(), b.size());
+
+  ASSERT_EQ(ra.iterations, rb.iterations);
+  ASSERT_DOUBLE_EQ(ra.time, rb.time);
+  for (size_t i = 0; i < a.size(); i++) ASSERT_EQ(a[i].tangent, b[i].tangent);
+}
+
+TEST_F(TangentOptimizer, Overrun) {
+  util::thread_pool pool(1);
+  optimizer_t       optimizer(pool, chassis, param, 2, 1024, 4096);
+  optimizer.configure(0.05);
+
+  std::array<hermite_t::waypoint, 3> wps = initial;
+  ASSERT_TRUE(optimizer.optimize(wps.data(), wps.size()).overrun);
+  ASSERT_EQ(initial[1].tangent, wps[1].tangent);
+}
@@ -0,0 +1,101 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using namespace grpl::pf;
+
+class Trajectory : public ::testing::Test {
+ protected:
+  using hermite_t = path::hermite_quintic;
+
+  void SetUp() override {
+    std::array<hermite_t::waypoint, 2> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                           hermite_t::waypoint{{4, 4}, {0, 5}, {0, 0}}};
+
+    std::vector<hermite_t> hermites;
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+
+    std::vector<path::augmented_arc2d> curves;
+    path::arc_parameterizer            param;
+    param.configure(0.01, 0.01);
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+    coupled::noncausal_trajectory_generator gen;
+    gen.configure(0.05);
+    states.resize(gen.state_count(curves.begin(), curves.end()));
+    gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size());
+  }
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<coupled::state> states;
+};
+
+TEST_F(Trajectory, Index) {
+  // Deliberately coarse index, such that buckets contain many states.
+  coupled::trajectory traj(states.begin(), states.end(), 7);
+
+  ASSERT_EQ(states.size(), traj.size());
+  ASSERT_DOUBLE_EQ(states.back().time, traj.duration());
+
+  for (double t = -0.1; t < traj.end_time() + 0.1; t += 0.001) {
+    size_t expected = 0;
+    while (expected + 1 < states.size() && states[expected + 1].time <= t) expected++;
+    ASSERT_EQ(expected, traj.index_at(t)) << "Time: " << t;
+  }
+}
+
+TEST_F(Trajectory, Sample) {
+  coupled::trajectory traj(states.begin(), states.end());
+
+  // Sampling on a state returns that state.
+  for (size_t i = 0; i < states.size(); i++) {
+    coupled::state st = traj.sample(states[i].time);
+    ASSERT_DOUBLE_EQ(states[i].kinematics[POSITION], st.kinematics[POSITION]) << "State: " << i;
+    ASSERT_DOUBLE_EQ(states[i].kinematics[VELOCITY], st.kinematics[VELOCITY]) << "State: " << i;
+  }
+
+  // Between states, kinematics must be consistent with the interval.
+  coupled::state last = traj.sample(0);
+  for (double t = 0.001; t < traj.end_time(); t += 0.001) {
+    coupled::state st = traj.sample(t);
+    size_t         i  = traj.index_at(t);
+
+    ASSERT_DOUBLE_EQ(t, st.time);
+    ASSERT_GE(st.kinematics[POSITION], last.kinematics[POSITION]) << "Time: " << t;
+    ASSERT_GE(st.kinematics[POSITION], states[i].kinematics[POSITION]) << "Time: " << t;
+    ASSERT_LE(st.kinematics[POSITION], states[i + 1].kinematics[POSITION]) << "Time: " << t;
+
+    double vmin = std::min(states[i].kinematics[VELOCITY], states[i + 1].kinematics[VELOCITY]);
+    double vmax = std::max(states[i].kinematics[VELOCITY], states[i + 1].kinematics[VELOCITY]);
+    ASSERT_GE(st.kinematics[VELOCITY], vmin - 1e-9) << "Time: " << t;
+    ASSERT_LE(st.kinematics[VELOCITY], vmax + 1e-9) << "Time: " << t;
+    ASSERT_FALSE(st.finished);
+
+    last = st;
+  }
+
+  coupled::state end = traj.sample(traj.end_time() + 1);
+  ASSERT_TRUE(end.finished);
+  ASSERT_DOUBLE_EQ(states.back().kinematics[POSITION], end.kinematics[POSITION]);
+  ASSERT_DOUBLE_EQ(0, end.kinematics[VELOCITY]);
+}
+
+TEST_F(Trajectory, SampleWheels) {
+  coupled::trajectory traj(states.begin(), states.end());
+
+  for (double t = 0; t < traj.end_time(); t += 0.02) {
+    auto split    = traj.sample_wheels(chassis, t);
+    auto expected = chassis.split(traj.sample(t));
+
+    ASSERT_DOUBLE_EQ(expected.first.kinematics[VELOCITY], split.first.kinematics[VELOCITY]);
+    ASSERT_DOUBLE_EQ(expected.second.kinematics[VELOCITY], split.second.kinematics[VELOCITY]);
+    ASSERT_DOUBLE_EQ(expected.first.voltage, split.first.voltage);
+  }
+}
@@ -0,0 +1,125 @@
+#include "grpl/pf.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <limits>
+#include <vector>
+
+using namespace grpl::pf;
+
+// A long straight into a tight corner, such that the causal generator must brake before the corner.
+class VelocityLookahead : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    using hermite_t = path::hermite_quintic;
+
+    std::array<hermite_t::waypoint, 3> wps{hermite_t::waypoint{{0, 0}, {5, 0}, {0, 0}},
+                                           hermite_t::waypoint{{6, 0}, {5, 0}, {0, 0}},
+                                           hermite_t::waypoint{{6.6, 0.6}, {0, 1}, {0, 0}}};
+
+    std::vector<hermite_t> hermites;
+    path::hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                               hermites.max_size());
+
+    path::arc_parameterizer param;
+    param.configure(0.01, 0.01);
+    param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+    ASSERT_FALSE(param.has_overrun());
+
+    for (auto &c : curves) total_length += c.length();
+    lookahead.build(chassis, curves.begin(), curves.end());
+  }
+
+  transmission::dc_motor dualCIM{12.0, 5330 * 2.0 * constants::PI / 60.0 / 12.75, 2 * 2.7, 2 * 131.0,
+                                 2 * 2.41 * 12.75};
+  coupled::chassis       chassis{dualCIM, dualCIM, 0.0762, 0.5, 25.0};
+
+  std::vector<path::augmented_arc2d> curves;
+  double                             total_length = 0;
+  coupled::velocity_lookahead        lookahead{0.01};
+};
+
+TEST_F(VelocityLookahead, Table) {
+  ASSERT_DOUBLE_EQ(std::numeric_limits<double>::infinity(), coupled::velocity_lookahead{}.max_velocity(1));
+  ASSERT_DOUBLE_EQ(total_length, lookahead.length());
+  ASSERT_DOUBLE_EQ(0, lookahead.max_velocity(total_length));
+  ASSERT_DOUBLE_EQ(0, lookahead.max_velocity(total_length + 1));
+
+  // The noncausal trajectory (samples at the same distances) additionally applies a forward pass, so never
+  // exceeds the table.
+  coupled::noncausal_trajectory_generator gen;
+  gen.configure(0.01);
+
+  std::vector<coupled::state> states(gen.state_count(curves.begin(), curves.end()));
+  ASSERT_EQ(states.size(),
+            gen.generate(chassis, curves.begin(), curves.end(), states.begin(), states.size()));
+  ASSERT_EQ(states.size(), lookahead.size());
+
+  for (size_t i = 0; i < states.size(); i++) {
+    const coupled::state &st = states[i];
+    double                v  = lookahead.max_velocity(st.kinematics[POSITION]);
+
+    ASSERT_LE(st.kinematics[VELOCITY], v + 1e-9) << "State: " << i;
+    ASSERT_LE(v, chassis.linear_vel_limit(st.config, st.curvature) + 1e-9) << "State: " << i;
+  }
+}
+
+TEST_F(VelocityLookahead, Causal) {
+  const coupled::causal_trajectory_generator gen{};
+  const profile::trapezoidal                 profile;
+
+  profile::trapezoidal::context ctx;
+  coupled::state                st;
+
+  // The velocity entering the corner is lower with the lookahead than without it.
+  double corner = 6.8, v_corner = 0, v_corner_unlimited = 0;
+
+  double t;
+  for (t = 0; !st.finished && t < 10; t += 0.01) {
+    coupled::state last  = st;
+    double         limit = gen.lookahead_velocity(lookahead, last, t);
+    st = gen.generate(chassis, curves.begin(), curves.end(), profile, ctx, lookahead, last, t);
+
+    ASSERT_LE(st.kinematics[VELOCITY], limit + 1e-6) << "Time: " << t;
+    if (last.kinematics[POSITION] < corner && st.kinematics[POSITION] >= corner)
+      v_corner = st.kinematics[VELOCITY];
+  }
+
+  ASSERT_TRUE(st.finished);
+  ASSERT_NEAR(total_length, st.kinematics[POSITION], 0.01);
+  ASSERT_NEAR(0, st.kinematics[VELOCITY], 0.05);
+
+  ctx = profile::trapezoidal::context{};
+  st  = coupled::state{};
+  for (t = 0; !st.finished && t < 10; t += 0.01) {
+    coupled::state last = st;
+    st = gen.generate(chassis, curves.begin(), curves.end(), profile, ctx, last, t);
+    if (last.kinematics[POSITION] < corner && st.kinematics[POSITION] >= corner)
+      v_corner_unlimited = st.kinematics[VELOCITY];
+  }
+
+  ASSERT_GT(v_corner, 0);
+  ASSERT_LT(v_corner, v_corner_unlimited);
+}
+
+TEST_F(VelocityLookahead, MatchesRealtime) {
+  const coupled::causal_trajectory_generator causal{};
+  coupled::realtime_trajectory_generator     realtime(curves.begin(), curves.end());
+  const profile::trapezoidal                 profile;
+  realtime.set_lookahead(&lookahead);
+
+  profile::trapezoidal::context ctx_causal, ctx_realtime;
+  coupled::state                st_causal, st_realtime;
+
+  for (double t = 0; !st_realtime.finished && t < 10; t += 0.01) {
+    st_causal =
+        causal.generate(chassis, curves.begin(), curves.end(), profile, ctx_causal, lookahead, st_causal, t);
+    st_realtime = realtime.generate(chassis, profile, ctx_realtime, st_realtime, t);
+
+    ASSERT_EQ(st_causal.finished, st_realtime.finished) << "Time: " << t;
+    ASSERT_EQ(st_causal.kinematics, st_realtime.kinematics) << "Time: " << t;
+  }
+
+  ASSERT_TRUE(st_realtime.finished);
+}
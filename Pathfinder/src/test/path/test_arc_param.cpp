@@ -115,4 +115,34 @@ TEST(ArcParam, Multispline) {
       si = 0;
     }
   }
-}
\ No newline at end of file
+}
+TEST(ArcParam, Context) {
+  using hermite_t = hermite_quintic;
+
+  std::array<hermite_t::waypoint, 3> wps{hermite_t::waypoint{{2, 2}, {5, 0}, {0, 0}},
+                                         hermite_t::waypoint{{3, 5}, {0, 5}, {0, 0}},
+                                         hermite_t::waypoint{{5, 7}, {2, 2}, {0, 0}}};
+
+  std::vector<hermite_t> hermites;
+  hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                       hermites.max_size());
+
+  arc_parameterizer param;
+  param.configure(0.1, 0.1);
+
+  const arc_parameterizer &shared   = param;
+  size_t                   required = param.curve_count(hermites.begin(), hermites.end());
+
+  std::vector<arc_parameterizer::curve_t> curves(required);
+  arc_parameterizer::context              ctx;
+  ASSERT_EQ(required, shared.parameterize(hermites.begin(), hermites.end(), curves.begin(), required, ctx));
+  ASSERT_FALSE(ctx.overrun);
+
+  // Not enough space for the first spline.
+  size_t first = param.curve_count(hermites[0]);
+  shared.parameterize(hermites.begin(), hermites.end(), curves.begin(), first - 1, ctx);
+  ASSERT_TRUE(ctx.overrun);
+
+  param.parameterize(hermites.begin(), hermites.end(), curves.begin(), first - 1);
+  ASSERT_TRUE(param.has_overrun());
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include "grpl/pf/path/incremental_path.h"
+
+#include <iterator>
+#include <vector>
+
+using namespace grpl::pf;
+using namespace grpl::pf::path;
+
+static std::vector<curve<2> *> flatten(const incremental_path<hermite_quintic> &path) {
+  std::vector<curve<2> *> out;
+  for (auto it = path.begin(); it != path.end(); it++) out.push_back(&it->get());
+  return out;
+}
+
+TEST(IncrementalPath, Update) {
+  using hermite_t = hermite_quintic;
+
+  std::vector<hermite_t::waypoint> wps;
+  for (int i = 0; i < 10; i++) wps.push_back(hermite_t::waypoint{{2.0 * i, i % 2}, {3, 0}, {0, 0}});
+
+  arc_parameterizer param;
+  param.configure(0.1, 0.1);
+
+  incremental_path<hermite_t> path(param);
+  path.set_waypoints(wps.begin(), wps.end());
+  ASSERT_EQ(9, path.segment_count());
+  ASSERT_DOUBLE_EQ(0, path.update());
+
+  // Move a single waypoint. Only the segments either side are dirty.
+  std::vector<curve<2> *> before = flatten(path);
+  wps[6].position                = hermite_t::vector_t{12, 2};
+  path.set_waypoint(6, wps[6]);
+
+  for (size_t i = 0; i < path.segment_count(); i++) ASSERT_EQ(i == 5 || i == 6, path.dirty(i)) << i;
+
+  double start = path.segment_start(5);
+  ASSERT_DOUBLE_EQ(start, path.update());
+
+  // Segments before the change are untouched.
+  std::vector<curve<2> *> after = flatten(path);
+  double                  s     = 0;
+  for (size_t i = 0; s + after[i]->length() < start - 1e-9; i++) {
+    ASSERT_EQ(before[i], after[i]) << "Curve: " << i;
+    s += after[i]->length();
+  }
+
+  // The result matches a full parameterization of the new waypoints.
+  std::vector<hermite_t>                  hermites;
+  std::vector<arc_parameterizer::curve_t> curves;
+  hermite_factory::generate<hermite_t>(wps.begin(), wps.end(), std::back_inserter(hermites),
+                                       hermites.max_size());
+  param.parameterize(hermites.begin(), hermites.end(), std::back_inserter(curves), curves.max_size());
+
+  ASSERT_EQ(curves.size(), path.curve_count());
+  double length = 0;
+  for (size_t i = 0; i < curves.size(); i++) {
+    ASSERT_EQ(curves[i].position(0), after[i]->position(0)) << "Curve: " << i;
+    ASSERT_DOUBLE_EQ(curves[i].length(), after[i]->length()) << "Curve: " << i;
+    length += curves[i].length();
+  }
+  ASSERT_NEAR(length, path.length(), 1e-9);
+
+  // Nothing changed.
+  ASSERT_DOUBLE_EQ(path.length(), path.update());
+}
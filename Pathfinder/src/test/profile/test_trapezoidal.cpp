@@ -49,4 +49,55 @@ TEST(Profile, Trapezoidal) {
 
   // Check setpoint has been reached at end of profile
   ASSERT_NEAR(kin[0], 5, 0.001);
-}
\ No newline at end of file
+}
+TEST(Profile, TrapezoidalContext) {
+  trapezoidal pr;
+  pr.apply_limit(VELOCITY, -3, 3);
+  pr.apply_limit(ACCELERATION, -3, 4);
+  pr.set_goal(5);
+
+  const trapezoidal   shared;
+  trapezoidal::context ctx;
+  ctx.goal = 5;
+  ctx.apply_limit(VELOCITY, -3, 3);
+  ctx.apply_limit(ACCELERATION, -3, 4);
+
+  ASSERT_EQ(pr.get_limits(), ctx.limits);
+  ASSERT_EQ(pr.get_context().limits, ctx.limits);
+
+  state st, st_ctx;
+  for (double t = 0; t < 7; t += 0.01) {
+    st     = pr.calculate(st, t);
+    st_ctx = shared.calculate(ctx, st_ctx, t);
+    ASSERT_EQ(st.kinematics, st_ctx.kinematics) << "Time: " << t;
+  }
+  ASSERT_NEAR(st_ctx.kinematics[POSITION], 5, 0.001);
+}
+
+TEST(Profile, TrapezoidalMaxSlices) {
+  trapezoidal::context ctx;
+  ctx.goal = 5;
+  ctx.apply_limit(VELOCITY, -3, 3);
+  ctx.apply_limit(ACCELERATION, -3, 4);
+
+  trapezoidal unbounded, bounded, loose;
+  bounded.set_max_slices(4);
+  loose.set_max_slices(1000);
+  ASSERT_EQ(0, unbounded.get_max_slices());
+
+  // A maximum above the slice count of each call does not change the profile.
+  state st, st_loose;
+  for (double t = 0; t < 7; t += 0.05) {
+    st       = unbounded.calculate(ctx, st, t);
+    st_loose = loose.calculate(ctx, st_loose, t);
+    ASSERT_EQ(st.kinematics, st_loose.kinematics) << "Time: " << t;
+  }
+
+  // A bounded profile still reaches the next time exactly, and the goal.
+  state st_bounded;
+  for (double t = 0; t < 7; t += 0.05) {
+    st_bounded = bounded.calculate(ctx, st_bounded, t);
+    ASSERT_DOUBLE_EQ(t, st_bounded.time);
+  }
+  ASSERT_NEAR(st_bounded.kinematics[POSITION], 5, 0.01);
+}
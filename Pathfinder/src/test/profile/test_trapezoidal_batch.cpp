@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "grpl/pf/profile/trapezoidal.h"
+#include "grpl/pf/profile/trapezoidal_batch.h"
+
+#include <vector>
+
+using namespace grpl::pf;
+using namespace grpl::pf::profile;
+
+static void batch_matches_scalar(double timeslice, double dt) {
+  const size_t N = 13;
+
+  trapezoidal_batch        batch(N);
+  std::vector<trapezoidal> scalars(N);
+  std::vector<state>       scalar_states(N);
+
+  batch.set_timeslice(timeslice);
+
+  for (size_t i = 0; i < N; i++) {
+    // Mix of forward and reverse goals, and asymmetric limits.
+    double goal = (i % 3 == 0 ? -1.0 : 1.0) * (1 + 0.7 * i);
+    double vel  = 1 + 0.25 * i;
+    double acc  = 2 + 0.5 * (i % 4);
+
+    scalars[i].set_goal(goal);
+    scalars[i].set_timeslice(timeslice);
+    scalars[i].apply_limit(VELOCITY, -vel, vel);
+    scalars[i].apply_limit(ACCELERATION, -acc, acc * 1.5);
+
+    batch.set_goal(i, goal);
+    batch.apply_limit(i, VELOCITY, -vel, vel);
+    batch.apply_limit(i, ACCELERATION, -acc, acc * 1.5);
+  }
+
+  for (double t = dt; t < 12; t += dt) {
+    batch.calculate(t);
+
+    for (size_t i = 0; i < N; i++) {
+      scalar_states[i] = scalars[i].calculate(scalar_states[i], t);
+
+      state bst = batch.get_state(i);
+      ASSERT_DOUBLE_EQ(scalar_states[i].time, bst.time);
+      ASSERT_DOUBLE_EQ(scalar_states[i].kinematics[POSITION], bst.kinematics[POSITION])
+          << "Profile: " << i << " Time: " << t;
+      ASSERT_DOUBLE_EQ(scalar_states[i].kinematics[VELOCITY], bst.kinematics[VELOCITY])
+          << "Profile: " << i << " Time: " << t;
+      ASSERT_DOUBLE_EQ(scalar_states[i].kinematics[ACCELERATION], bst.kinematics[ACCELERATION])
+          << "Profile: " << i << " Time: " << t;
+    }
+  }
+
+  for (size_t i = 0; i < N; i++) {
+    ASSERT_NEAR(batch.position()[i], batch.get_goal(i), 0.01) << "Profile: " << i;
+  }
+}
+
+TEST(Profile, TrapezoidalBatchNoTimeslice) {
+  batch_matches_scalar(0, 0.001);
+}
+
+TEST(Profile, TrapezoidalBatchTimeslice) {
+  batch_matches_scalar(0.001, 0.01);
+}
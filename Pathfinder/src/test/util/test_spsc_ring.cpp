@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "grpl/pf/util/spsc_ring.h"
+
+#include <thread>
+
+using namespace grpl::pf;
+
+TEST(SPSCRing, PushPop) {
+  util::spsc_ring<int> ring(5);
+  ASSERT_EQ(8, ring.capacity());
+
+  int value;
+  ASSERT_FALSE(ring.pop(value));
+
+  for (int i = 0; i < 8; i++) ASSERT_TRUE(ring.push(i));
+  ASSERT_FALSE(ring.push(8));
+  ASSERT_EQ(8, ring.size());
+  ASSERT_EQ(1, ring.dropped());
+
+  for (int i = 0; i < 8; i++) {
+    ASSERT_TRUE(ring.pop(value));
+    ASSERT_EQ(i, value);
+  }
+  ASSERT_FALSE(ring.pop(value));
+
+  // Wrap around the end of the storage.
+  for (int i = 0; i < 20; i++) {
+    ASSERT_TRUE(ring.push(i));
+    ASSERT_TRUE(ring.pop(value));
+    ASSERT_EQ(i, value);
+  }
+}
+
+TEST(SPSCRing, Threaded) {
+  const int            count = 100000;
+  util::spsc_ring<int> ring(64);
+
+  std::thread producer([&]() {
+    for (int i = 0; i < count; i++)
+      while (!ring.push(i)) std::this_thread::yield();
+  });
+
+  // Every sample arrives exactly once, in order.
+  int expected = 0, value;
+  while (expected < count) {
+    if (!ring.pop(value))
+      std::this_thread::yield();
+    else if (value == expected)
+      expected++;
+    else
+      break;
+  }
+  producer.join();
+
+  ASSERT_EQ(count, expected);
+  ASSERT_FALSE(ring.pop(value));
+}
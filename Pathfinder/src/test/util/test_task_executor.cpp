@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "grpl/pf/util/task_executor.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+using namespace grpl::pf;
+
+using executor_t = util::task_executor;
+
+// Blocks the (single) worker of an executor until released, such that tasks queue up behind it.
+class TaskExecutorGate {
+ public:
+  TaskExecutorGate(executor_t &exec) {
+    _task = exec.submit([this](executor_t::task &) {
+      std::unique_lock<std::mutex> lock(_mtx);
+      _started = true;
+      _cv.notify_all();
+      _cv.wait(lock, [this] { return _released; });
+    });
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    _cv.wait(lock, [this] { return _started; });
+  }
+
+  void release() {
+    {
+      std::lock_guard<std::mutex> lock(_mtx);
+      _released = true;
+    }
+    _cv.notify_all();
+    _task->wait();
+  }
+
+ private:
+  std::mutex              _mtx;
+  std::condition_variable _cv;
+  bool                    _started = false, _released = false;
+  executor_t::task_ptr    _task;
+};
+
+TEST(TaskExecutor, Submit) {
+  executor_t exec(4);
+  ASSERT_EQ(4, exec.size());
+
+  std::atomic<int>                  sum{0};
+  std::vector<executor_t::task_ptr> tasks;
+  for (int i = 1; i <= 100; i++) tasks.push_back(exec.submit([&sum, i](executor_t::task &) { sum += i; }));
+
+  for (auto &t : tasks) {
+    t->wait();
+    ASSERT_TRUE(t->done());
+    ASSERT_EQ(executor_t::status::completed, t->get_status());
+  }
+  ASSERT_EQ(5050, sum.load());
+}
+
+TEST(TaskExecutor, UrgentFirst) {
+  executor_t       exec(1);
+  TaskExecutorGate gate(exec);
+
+  std::vector<int> order;
+  auto             record = [&order](int id) {
+    return [&order, id](executor_t::task &) { order.push_back(id); };
+  };
+
+  exec.submit(record(0));
+  exec.submit(record(1));
+  exec.submit(record(2), executor_t::priority::urgent);
+  auto last = exec.submit(record(3));
+  ASSERT_EQ(4, exec.queued());
+
+  gate.release();
+  last->wait();
+  ASSERT_EQ((std::vector<int>{2, 0, 1, 3}), order);
+}
+
+TEST(TaskExecutor, CancelQueued) {
+  executor_t       exec(1);
+  TaskExecutorGate gate(exec);
+
+  bool ran = false;
+  auto t   = exec.submit([&ran](executor_t::task &) { ran = true; });
+  ASSERT_EQ(executor_t::status::pending, t->get_status());
+  ASSERT_FALSE(t->wait_for(std::chrono::milliseconds(1)));
+
+  ASSERT_TRUE(t->cancel());
+  ASSERT_TRUE(t->done());
+  ASSERT_EQ(executor_t::status::cancelled, t->get_status());
+
+  gate.release();
+  exec.submit([](executor_t::task &) {})->wait();
+  ASSERT_FALSE(ran);
+}
+
+TEST(TaskExecutor, CancelRunning) {
+  executor_t exec(1);
+
+  std::atomic<bool> started{false};
+  auto              t = exec.submit([&started](executor_t::task &self) {
+    started = true;
+    while (!self.cancel_requested()) std::this_thread::yield();
+  });
+
+  while (!started) std::this_thread::yield();
+  ASSERT_EQ(executor_t::status::running, t->get_status());
+  ASSERT_TRUE(t->cancel());
+  t->wait();
+  ASSERT_EQ(executor_t::status::cancelled, t->get_status());
+
+  // A completed task can't be cancelled.
+  auto done = exec.submit([](executor_t::task &) {});
+  done->wait();
+  ASSERT_FALSE(done->cancel());
+  ASSERT_EQ(executor_t::status::completed, done->get_status());
+}
+
+TEST(TaskExecutor, DestroyCancels) {
+  executor_t::task_ptr queued, running;
+  {
+    executor_t        exec(1);
+    std::atomic<bool> started{false};
+    running = exec.submit([&started](executor_t::task &self) {
+      started = true;
+      while (!self.cancel_requested()) std::this_thread::yield();
+    });
+    queued  = exec.submit([](executor_t::task &) {});
+    while (!started) std::this_thread::yield();
+  }
+  ASSERT_EQ(executor_t::status::cancelled, running->get_status());
+  ASSERT_EQ(executor_t::status::cancelled, queued->get_status());
+}
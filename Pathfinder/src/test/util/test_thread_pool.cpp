@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "grpl/pf/util/thread_pool.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace grpl::pf;
+
+TEST(ThreadPool, ParallelFor) {
+  util::thread_pool pool(4);
+  ASSERT_EQ(4, pool.size());
+
+  std::vector<int>    hits(1000, 0);
+  std::vector<size_t> worker_of(1000, 0);
+
+  for (int round = 1; round <= 5; round++) {
+    auto fn = [&](size_t idx, size_t worker) {
+      hits[idx]++;
+      worker_of[idx] = worker;
+    };
+    pool.parallel_for(hits.size(), fn);
+
+    for (size_t i = 0; i < hits.size(); i++) {
+      ASSERT_EQ(round, hits[i]) << "Index: " << i;
+      ASSERT_LT(worker_of[i], pool.size()) << "Index: " << i;
+    }
+  }
+}
+
+TEST(ThreadPool, Inline) {
+  util::thread_pool pool(1);
+
+  std::atomic<size_t> sum{0};
+  auto                fn = [&](size_t idx, size_t worker) {
+    ASSERT_EQ(0, worker);
+    sum += idx;
+  };
+  pool.parallel_for(100, fn);
+  pool.parallel_for(0, fn);
+
+  ASSERT_EQ(4950, sum.load());
+}